@@ -0,0 +1,500 @@
+/**
+ * @file dynamic_graph_snapshots.cpp
+ * @author LuShadowX
+ * @brief Mutable graph container (blocked adjacency + tombstones + compaction) with epoch snapshots.
+ * @difficulty: Hard (Rank S)
+ * @tags: Graph Theory, Dynamic Graphs, MVCC, Epoch-Based Reclamation, Lock-Free Readers
+ * @logic: One writer mutates the graph while any number of readers traverse it.
+ * 1. BLOCKED ADJACENCY: each vertex owns a chain of fixed-size blocks. Inserting an
+ *    edge appends an entry to the tail block (a new block only when it is full), so
+ *    neighbors stay mostly contiguous and nothing is ever moved under a reader.
+ * 2. VERSIONING: every entry carries [insertEpoch, deleteEpoch). The writer stamps
+ *    changes with the pending epoch and publishes them with commit(). A snapshot
+ *    pinned at epoch e sees exactly the entries with insertEpoch <= e < deleteEpoch,
+ *    so a traversal sees one consistent graph no matter what the writer does.
+ * 3. TOMBSTONES: deleting sets deleteEpoch; the entry stays readable for older
+ *    snapshots.
+ * 4. COMPACTION: when tombstones pile up, the vertex is queued and compacted by the
+ *    next commit(), once its tombstones are published and can actually be dropped.
+ *    The writer builds a fresh chain holding only entries some snapshot can still
+ *    see and swaps the chain head atomically.
+ *    The old chain is retired and freed once every reader that could still hold it
+ *    has moved past the retirement epoch (epoch-based reclamation).
+ * Readers never lock: they register their epoch in a slot and walk atomics.
+ * Solution::bfs / dfs / dijkstra mirror the existing files but take a Snapshot.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL & ALGORITHMIC FOUNDATION
+ * ============================================================================
+ * [Visibility Rule]
+ * visible(entry, e)  <=>  entry.insertEpoch <= e  AND  e < entry.deleteEpoch.
+ * Writer changes carry epoch W = committed + 1, so no snapshot (epoch <= committed)
+ * sees a half-applied batch. commit() publishes W with a single atomic store.
+ *
+ * [Safe Compaction]
+ * Let m = min(epoch of every active snapshot, committed). An entry with
+ * deleteEpoch <= m is invisible to every current and future snapshot and can be
+ * dropped; every other entry is copied with its epochs unchanged.
+ *
+ * [Safe Reclamation]
+ * A chain retired during write epoch W may still be referenced by readers whose
+ * snapshot epoch is < W. It is freed once every registered reader has epoch >= W.
+ * Readers re-check the committed epoch after registering, which closes the race
+ * with a concurrent scan.
+ *
+ * [Compaction Trigger]
+ * Tombstones stamped with the pending epoch are above every reader's horizon, so
+ * compacting inside deleteEdge could drop none of them. Instead a vertex is queued
+ * when its tombstones NEW since the last compaction exceed max(2 * BLOCK, live).
+ * commit() compacts it right after publishing. The threshold counts only new
+ * tombstones, because the ones a pinned reader forced the last compaction to keep
+ * must not re-trigger it on every delete. Each compaction copies O(deg + tombstones)
+ * entries and at least max(2 * BLOCK, live) deletes happen between two compactions,
+ * so the cost is O(1) amortized per delete.
+ *
+ * [Complexity]
+ * - insertEdge: O(1) amortized.  deleteEdge(u, v): O(deg(u)).
+ * - Snapshot neighbor scan: O(deg(u) + tombstones(u)).
+ * - compact(u): O(deg(u) + tombstones(u)).
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Living Network Protocol
+ * RANK: S (Concurrent Dynamic Graph Storage)
+ * DEPARTMENT: Graph Theory & Systems Engineering
+ * CHALLENGE:
+ * Support continuous edge inserts and deletes while BFS / DFS / Dijkstra queries
+ * run concurrently on consistent, lock-free snapshots of the graph.
+ * CONSTRAINTS:
+ * - Single writer thread, any number of reader threads (up to MAX_READERS snapshots).
+ * - Space Complexity: O(V + E + tombstones) plus retired chains awaiting reclamation.
+ * - Directed edges {u, v, weight}; insert both directions for an undirected graph.
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+class DynamicGraph {
+public:
+    static constexpr uint64_t NEVER = UINT64_MAX;   // deleteEpoch of a live edge
+    static constexpr int BLOCK = 16;                // Entries per adjacency block
+    static constexpr int MAX_READERS = 64;          // Concurrent snapshot slots
+
+private:
+    struct Entry {
+        int to;
+        int weight;
+        uint64_t insertEpoch;
+        atomic<uint64_t> deleteEpoch;
+    };
+
+    struct Block {
+        atomic<int> count{0};
+        atomic<Block*> next{nullptr};
+        Entry entries[BLOCK];
+    };
+
+    struct VertexState {
+        atomic<Block*> head{nullptr};
+        Block* tail = nullptr;   // Writer-only
+        int live = 0;            // Writer-only bookkeeping
+        int dead = 0;
+        int keptDead = 0;        // Tombstones the last compaction had to keep
+        bool queued = false;     // In compactQueue, waiting for commit()
+    };
+
+    struct alignas(64) ReaderSlot {
+        atomic<uint64_t> epoch{0}; // 0 = idle, otherwise pinned epoch + 1
+    };
+
+    int V;
+    vector<VertexState> vertices;
+    atomic<uint64_t> committed{1};      // Last published epoch
+    uint64_t pending = 2;               // Epoch stamped on the writer's next changes
+    mutable ReaderSlot slots[MAX_READERS];   // Written by readers, hence mutable
+    vector<pair<uint64_t, Block*>> retired; // {retire epoch, chain head}
+    vector<int> compactQueue;           // Vertices to compact at the next commit()
+
+    static void freeChain(Block* b) {
+        while (b) {
+            Block* next = b->next.load(memory_order_relaxed);
+            delete b;
+            b = next;
+        }
+    }
+
+    /**
+     * Smallest epoch any registered reader is pinned to (committed if none).
+     */
+    uint64_t minReaderEpoch() const {
+        uint64_t m = committed.load();
+        for (auto& s : slots) {
+            uint64_t e = s.epoch.load();
+            if (e != 0) m = min(m, e - 1);
+        }
+        return m;
+    }
+
+    void append(VertexState& vs, int to, int weight, uint64_t ins, uint64_t del) {
+        Block* t = vs.tail;
+        if (t == nullptr || t->count.load(memory_order_relaxed) == BLOCK) {
+            Block* b = new Block();
+            if (t == nullptr) vs.head.store(b, memory_order_release);
+            else t->next.store(b, memory_order_release);
+            vs.tail = t = b;
+        }
+        int i = t->count.load(memory_order_relaxed);
+        Entry& e = t->entries[i];
+        e.to = to;
+        e.weight = weight;
+        e.insertEpoch = ins;
+        e.deleteEpoch.store(del, memory_order_relaxed);
+        t->count.store(i + 1, memory_order_release); // Publish the entry
+    }
+
+    /**
+     * Frees retired chains that no registered reader can still reach.
+     */
+    void reclaim() {
+        if (retired.empty()) return;
+        uint64_t safe = minReaderEpoch();
+        size_t keep = 0;
+        for (auto& r : retired) {
+            if (r.first <= safe) freeChain(r.second);
+            else retired[keep++] = r;
+        }
+        retired.resize(keep);
+    }
+
+public:
+    /**
+     * A pinned, read-only view of the graph at one committed epoch (RAII).
+     */
+    class Snapshot {
+    private:
+        const DynamicGraph* g;
+        uint64_t at;
+        int slot;
+
+    public:
+        Snapshot(const DynamicGraph* g, uint64_t at, int slot) : g(g), at(at), slot(slot) {}
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        ~Snapshot() { g->slots[slot].epoch.store(0); }
+
+        int vertices() const { return g->V; }
+        uint64_t epoch() const { return at; }
+
+        /**
+         * Calls fn(neighbor, weight) for every edge of u visible at this epoch.
+         */
+        template <typename Fn>
+        void forEachNeighbor(int u, Fn&& fn) const {
+            for (Block* b = g->vertices[u].head.load(memory_order_acquire); b;
+                 b = b->next.load(memory_order_acquire)) {
+                int n = b->count.load(memory_order_acquire);
+                for (int i = 0; i < n; i++) {
+                    const Entry& e = b->entries[i];
+                    if (e.insertEpoch <= at && at < e.deleteEpoch.load(memory_order_acquire)) {
+                        fn(e.to, e.weight);
+                    }
+                }
+            }
+        }
+    };
+
+    explicit DynamicGraph(int V) : V(V), vertices(V) {}
+
+    ~DynamicGraph() {
+        for (auto& vs : vertices) freeChain(vs.head.load());
+        for (auto& r : retired) freeChain(r.second);
+    }
+
+    /**
+     * Pins the latest committed epoch. Throws if every reader slot is taken.
+     */
+    unique_ptr<Snapshot> snapshot() const {
+        for (int s = 0; s < MAX_READERS; s++) {
+            uint64_t idle = 0;
+            uint64_t e = committed.load();
+            if (!slots[s].epoch.compare_exchange_strong(idle, e + 1)) continue;
+            // Re-check: if the writer published in between, pin the newer epoch.
+            while (true) {
+                uint64_t now = committed.load();
+                if (now == e) break;
+                e = now;
+                slots[s].epoch.store(e + 1);
+            }
+            return make_unique<Snapshot>(this, e, s);
+        }
+        throw runtime_error("DynamicGraph: too many concurrent snapshots");
+    }
+
+    // ---------------- Writer API (single thread) ----------------
+
+    void insertEdge(int u, int v, int weight = 1) {
+        append(vertices[u], v, weight, pending, NEVER);
+        vertices[u].live++;
+    }
+
+    /**
+     * Tombstones one live u -> v edge. @return false if none exists.
+     */
+    bool deleteEdge(int u, int v) {
+        VertexState& vs = vertices[u];
+        for (Block* b = vs.head.load(memory_order_relaxed); b; b = b->next.load(memory_order_relaxed)) {
+            int n = b->count.load(memory_order_relaxed);
+            for (int i = 0; i < n; i++) {
+                Entry& e = b->entries[i];
+                if (e.to == v && e.deleteEpoch.load(memory_order_relaxed) == NEVER) {
+                    e.deleteEpoch.store(pending, memory_order_release);
+                    vs.live--;
+                    vs.dead++;
+                    int fresh = vs.dead - vs.keptDead;
+                    if (!vs.queued && fresh > 2 * BLOCK && fresh > vs.live) {
+                        vs.queued = true;
+                        compactQueue.push_back(u);
+                    }
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Publishes every change made since the previous commit as one new epoch,
+     * then compacts the vertices whose tombstones crossed the threshold.
+     */
+    uint64_t commit() {
+        committed.store(pending);
+        pending++;
+        for (int u : compactQueue) {
+            vertices[u].queued = false;
+            compact(u);
+        }
+        compactQueue.clear();
+        reclaim();
+        return committed.load();
+    }
+
+    /**
+     * Rebuilds u's chain without entries that no snapshot can see any more.
+     */
+    void compact(int u) {
+        VertexState& vs = vertices[u];
+        uint64_t horizon = minReaderEpoch();
+        Block* old = vs.head.load(memory_order_relaxed);
+
+        VertexState fresh;
+        for (Block* b = old; b; b = b->next.load(memory_order_relaxed)) {
+            int n = b->count.load(memory_order_relaxed);
+            for (int i = 0; i < n; i++) {
+                Entry& e = b->entries[i];
+                uint64_t del = e.deleteEpoch.load(memory_order_relaxed);
+                if (del <= horizon) continue; // Invisible to everyone, now and later
+                append(fresh, e.to, e.weight, e.insertEpoch, del);
+                if (del != NEVER) fresh.dead++;
+            }
+        }
+
+        vs.head.store(fresh.head.load(memory_order_relaxed), memory_order_release);
+        vs.tail = fresh.tail;
+        vs.dead = fresh.dead;
+        vs.keptDead = fresh.dead;
+        if (old) retired.push_back({pending, old});
+    }
+
+    /**
+     * Compacts every vertex carrying tombstones (periodic maintenance).
+     */
+    void compactAll() {
+        for (int u = 0; u < V; u++) {
+            if (vertices[u].dead > 0) compact(u);
+        }
+    }
+
+    int vertexCount() const { return V; }
+    size_t retiredChains() const { return retired.size(); }
+};
+
+using Snapshot = DynamicGraph::Snapshot;
+
+class Solution {
+public:
+    /**
+     * BFS from 'src' on a snapshot (same contract as Solution::bfs, any start node).
+     */
+    vector<int> bfs(const Snapshot& snap, int src) {
+        int V = snap.vertices();
+        vector<int> bfsOrder;
+        vector<int> visited(V, 0);
+        queue<int> q;
+        visited[src] = 1;
+        q.push(src);
+        while (!q.empty()) {
+            int node = q.front();
+            q.pop();
+            bfsOrder.push_back(node);
+            snap.forEachNeighbor(node, [&](int neighbor, int) {
+                if (visited[neighbor] == 0) {
+                    visited[neighbor] = 1;
+                    q.push(neighbor);
+                }
+            });
+        }
+        return bfsOrder;
+    }
+
+    /**
+     * Iterative DFS preorder from 'src' (explicit stack, safe on deep graphs).
+     */
+    vector<int> dfs(const Snapshot& snap, int src) {
+        int V = snap.vertices();
+        vector<int> order, visited(V, 0), stk = {src}, scratch;
+        while (!stk.empty()) {
+            int node = stk.back();
+            stk.pop_back();
+            if (visited[node]) continue;
+            visited[node] = 1;
+            order.push_back(node);
+            scratch.clear();
+            snap.forEachNeighbor(node, [&](int neighbor, int) {
+                if (!visited[neighbor]) scratch.push_back(neighbor);
+            });
+            // Push in reverse so neighbors are explored in adjacency order.
+            stk.insert(stk.end(), scratch.rbegin(), scratch.rend());
+        }
+        return order;
+    }
+
+    /**
+     * Dijkstra on a snapshot (1e9 marks unreachable, as in Dijkstra_Priority_Queue.c++).
+     */
+    vector<int> dijkstra(const Snapshot& snap, int src) {
+        int V = snap.vertices();
+        priority_queue<pair<int,int>, vector<pair<int,int>>, greater<pair<int,int>>> pq;
+        vector<int> distance(V, 1e9);
+        distance[src] = 0;
+        pq.push({0, src});
+        while (!pq.empty()) {
+            int node = pq.top().second;
+            int weight = pq.top().first;
+            pq.pop();
+            if (weight > distance[node]) continue;
+            snap.forEachNeighbor(node, [&](int neighbor, int edgeWeight) {
+                if (weight + edgeWeight < distance[neighbor]) {
+                    distance[neighbor] = weight + edgeWeight;
+                    pq.push({distance[neighbor], neighbor});
+                }
+            });
+        }
+        return distance;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Stress) =================
+
+void printVec(const string& label, const vector<int>& v) {
+    cout << label << "[ ";
+    for (size_t i = 0; i < v.size(); ++i) cout << v[i] << (i == v.size() - 1 ? "" : ", ");
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    // --- Phase 1: Snapshot isolation on a tiny graph ---
+    DynamicGraph g(5);
+    g.insertEdge(0, 1, 4);
+    g.insertEdge(0, 2, 1);
+    g.insertEdge(2, 1, 1);
+    g.insertEdge(1, 3, 5);
+    g.commit();
+
+    cout << "INITIATING LIVING NETWORK PROTOCOL..." << endl;
+    auto before = g.snapshot();
+
+    g.deleteEdge(2, 1);     // Writer keeps going while 'before' is pinned
+    g.insertEdge(3, 4, 2);
+    g.commit();
+    auto after = g.snapshot();
+
+    printVec("Epoch " + to_string(before->epoch()) + " BFS      : ", solver.bfs(*before, 0));
+    printVec("Epoch " + to_string(before->epoch()) + " Dijkstra : ", solver.dijkstra(*before, 0));
+    printVec("Epoch " + to_string(after->epoch()) + " BFS      : ", solver.bfs(*after, 0));
+    printVec("Epoch " + to_string(after->epoch()) + " DFS      : ", solver.dfs(*after, 0));
+    printVec("Epoch " + to_string(after->epoch()) + " Dijkstra : ", solver.dijkstra(*after, 0));
+    // Expected: old epoch reaches 1 via 2 (dist 2); new epoch pays 4 and reaches 4.
+    before.reset();
+    after.reset();
+    cout << "-----------------------------" << endl;
+
+    // --- Phase 2: Concurrent stress (1 writer, several readers) ---
+    int V = argc > 1 ? atoi(argv[1]) : 20000;
+    int millis = argc > 2 ? atoi(argv[2]) : 1000;
+    int readers = argc > 3 ? atoi(argv[3]) : 3;
+    DynamicGraph live(V);
+    mt19937 seed(34);
+    vector<pair<int,int>> present;
+    for (int i = 0; i < 4 * V; i++) {
+        int u = seed() % V, v = seed() % V;
+        live.insertEdge(u, v, 1 + seed() % 9);
+        present.push_back({u, v});
+    }
+    live.commit();
+
+    atomic<bool> stop(false);
+    atomic<long long> queries(0), inconsistent(0);
+    vector<thread> pool;
+    for (int r = 0; r < readers; r++) {
+        pool.emplace_back([&, r]() {
+            mt19937 rng(100 + r);
+            while (!stop.load()) {
+                auto snap = live.snapshot();
+                int src = rng() % V;
+                // Two passes over the same snapshot must agree exactly.
+                vector<int> d1 = solver.dijkstra(*snap, src);
+                vector<int> b1 = solver.bfs(*snap, src);
+                vector<int> d2 = solver.dijkstra(*snap, src);
+                if (d1 != d2 || b1.size() != solver.bfs(*snap, src).size()) inconsistent++;
+                queries++;
+            }
+        });
+    }
+
+    long long ops = 0, commits = 0;
+    mt19937 rng(35);
+    auto deadline = chrono::steady_clock::now() + chrono::milliseconds(millis);
+    while (chrono::steady_clock::now() < deadline) {
+        for (int k = 0; k < 64; k++, ops++) {
+            if (rng() % 2 && !present.empty()) {
+                size_t idx = rng() % present.size();
+                live.deleteEdge(present[idx].first, present[idx].second);
+                present[idx] = present.back();
+                present.pop_back();
+            } else {
+                int u = rng() % V, v = rng() % V;
+                live.insertEdge(u, v, 1 + rng() % 9);
+                present.push_back({u, v});
+            }
+        }
+        live.commit();
+        if (++commits % 256 == 0) live.compactAll();
+    }
+    stop = true;
+    for (auto& t : pool) t.join();
+    live.compactAll();
+    live.commit();
+
+    cout << "STRESS: " << V << " vertices, " << readers << " reader threads, " << millis << " ms" << endl;
+    cout << "  writer ops            : " << ops << " in " << commits << " commits" << endl;
+    cout << "  snapshot queries      : " << queries.load() << endl;
+    cout << "  inconsistent snapshots: " << inconsistent.load() << endl;
+    cout << "  chains awaiting free  : " << live.retiredChains() << endl;
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
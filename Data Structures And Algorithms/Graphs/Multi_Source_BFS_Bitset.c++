@@ -0,0 +1,281 @@
+/**
+ * @file multi_source_bfs_bitset.cpp
+ * @author LuShadowX
+ * @brief Multi-Source BFS (MS-BFS): up to 64 / 256 concurrent traversals with per-vertex bitmasks.
+ * @difficulty: Hard (Rank A)
+ * @tags: Graph Theory, BFS, Bit Manipulation, Closeness Centrality, Eccentricity
+ * @logic: Running Solution::bfs once per source re-reads the same adjacency lists
+ * hundreds of times. MS-BFS runs a batch of W sources together: bit i of a vertex
+ * mask belongs to BFS number i.
+ * - seen[v]      : traversals that have already reached v.
+ * - visit[v]     : traversals for which v is on the current frontier.
+ * - visitNext[v] : traversals for which v joins the next frontier.
+ * One level = for every frontier vertex v, for every neighbor n:
+ *     visitNext[n] |= visit[v] & ~seen[n]
+ * so each adjacency list is read once per level for all W traversals together.
+ * New bits of visitNext[n] give the distance of n from those sources.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL & ALGORITHMIC FOUNDATION
+ * ============================================================================
+ * [Bit-Parallel Frontier]
+ * For traversal i, the classic BFS rule "n is discovered at level L+1 if some
+ * neighbor v is at level L and n is unseen" is exactly bit i of
+ * visit[v] & ~seen[n]. OR-ing over neighbors evaluates it for all W bits at once.
+ *
+ * [Work Bound]
+ * Single-source BFS W times: W * O(V + E).
+ * MS-BFS: each level touches the union of the W frontiers, so a vertex's list is
+ * read at most once per level in which some traversal has it on the frontier.
+ * On small-diameter graphs the frontiers overlap heavily and work drops to
+ * roughly (levels) * O(V + E) word operations per batch.
+ *
+ * [Space Complexity]
+ * 3 masks of W bits per vertex: 3 * V * W / 8 bytes (96 bytes/vertex for W = 256).
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Swarm Exploration Protocol
+ * RANK: A (Bit-Parallel Graph Traversal)
+ * DEPARTMENT: Graph Theory & Performance Engineering
+ * CHALLENGE:
+ * Compute BFS distances (or closeness / eccentricity summaries) from hundreds of
+ * sources while reading each adjacency list once per level per batch.
+ * CONSTRAINTS:
+ * - Time Complexity: O(batches * levels * (V + E)) word operations worst case.
+ * - Space Complexity: O(V * W / 8) bytes for masks, plus O(S * V) if distances are kept.
+ * - The graph is 0-indexed; edges are followed as given (directed adjacency).
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Fixed-width bitmask of W bits built from 64-bit words; the compiler vectorizes the loops.
+template <int W>
+struct Mask {
+    static constexpr int WORDS = W / 64;
+    uint64_t w[WORDS];
+
+    void clear() { for (int i = 0; i < WORDS; i++) w[i] = 0; }
+    bool any() const {
+        uint64_t acc = 0;
+        for (int i = 0; i < WORDS; i++) acc |= w[i];
+        return acc != 0;
+    }
+};
+
+// Aggregated per-source statistics (no V-sized distance array needed).
+struct SourceStats {
+    long long reached = 0;       // Vertices reachable from the source (including itself)
+    long long distanceSum = 0;   // Σ dist(source, v) over reachable v
+    int eccentricity = 0;        // max dist(source, v) over reachable v
+
+    double closeness() const { return distanceSum > 0 ? (reached - 1) / (double)distanceSum : 0.0; }
+};
+
+template <int W>
+class MultiSourceBFS {
+private:
+    int V;
+    vector<int> xadj, adjncy;              // CSR copy of the adjacency list
+    vector<Mask<W>> seen, visit, visitNext;
+
+public:
+    explicit MultiSourceBFS(const vector<vector<int>>& adj) : V(adj.size()), xadj(V + 1, 0) {
+        for (int v = 0; v < V; v++) xadj[v + 1] = xadj[v] + adj[v].size();
+        adjncy.reserve(xadj[V]);
+        for (auto& row : adj) adjncy.insert(adjncy.end(), row.begin(), row.end());
+        seen.resize(V);
+        visit.resize(V);
+        visitNext.resize(V);
+    }
+
+    /**
+     * THE SWARM (one batch of at most W sources)
+     * @param sources Batch of source vertices (size <= W).
+     * @param onDiscover Called as onDiscover(bit, vertex, level) for every newly reached pair.
+     * @throws invalid_argument if the batch has more than W sources (bit i lives in word i / 64).
+     */
+    template <typename Callback>
+    void runBatch(const vector<int>& sources, Callback&& onDiscover) {
+        if (sources.size() > (size_t)W) {
+            throw invalid_argument("MultiSourceBFS: batch of " + to_string(sources.size()) +
+                                   " sources exceeds width " + to_string(W));
+        }
+        for (int v = 0; v < V; v++) { seen[v].clear(); visit[v].clear(); visitNext[v].clear(); }
+
+        for (size_t i = 0; i < sources.size(); i++) {
+            int s = sources[i];
+            seen[s].w[i / 64] |= 1ULL << (i % 64);
+            visit[s].w[i / 64] |= 1ULL << (i % 64);
+            onDiscover((int)i, s, 0);
+        }
+
+        for (int level = 1;; level++) {
+            bool frontier = false;
+
+            // Expansion: push each frontier mask to all neighbors at once.
+            for (int v = 0; v < V; v++) {
+                if (!visit[v].any()) continue;
+                const Mask<W>& mv = visit[v];
+                for (int e = xadj[v]; e < xadj[v + 1]; e++) {
+                    Mask<W>& next = visitNext[adjncy[e]];
+                    for (int k = 0; k < Mask<W>::WORDS; k++) next.w[k] |= mv.w[k];
+                }
+            }
+
+            // Filtering: drop already-seen bits, record discoveries, swap frontiers.
+            for (int v = 0; v < V; v++) {
+                Mask<W>& next = visitNext[v];
+                for (int k = 0; k < Mask<W>::WORDS; k++) {
+                    uint64_t fresh = next.w[k] & ~seen[v].w[k];
+                    visit[v].w[k] = fresh;
+                    next.w[k] = 0;
+                    if (!fresh) continue;
+                    frontier = true;
+                    seen[v].w[k] |= fresh;
+                    while (fresh) {
+                        int bit = __builtin_ctzll(fresh);
+                        onDiscover(k * 64 + bit, v, level);
+                        fresh &= fresh - 1;
+                    }
+                }
+            }
+            if (!frontier) break;
+        }
+    }
+
+    /**
+     * Full distance arrays: result[i][v] = dist(sources[i], v), -1 if unreachable.
+     */
+    vector<vector<int>> distances(const vector<int>& sources) {
+        vector<vector<int>> dist(sources.size(), vector<int>(V, -1));
+        for (size_t base = 0; base < sources.size(); base += W) {
+            vector<int> batch(sources.begin() + base, sources.begin() + min(sources.size(), base + W));
+            runBatch(batch, [&](int bit, int v, int level) { dist[base + bit][v] = level; });
+        }
+        return dist;
+    }
+
+    /**
+     * Aggregated statistics only (closeness / eccentricity), O(S) extra memory.
+     */
+    vector<SourceStats> statistics(const vector<int>& sources) {
+        vector<SourceStats> stats(sources.size());
+        for (size_t base = 0; base < sources.size(); base += W) {
+            vector<int> batch(sources.begin() + base, sources.begin() + min(sources.size(), base + W));
+            runBatch(batch, [&](int bit, int, int level) {
+                SourceStats& st = stats[base + bit];
+                st.reached++;
+                st.distanceSum += level;
+                st.eccentricity = max(st.eccentricity, level);
+            });
+        }
+        return stats;
+    }
+};
+
+class Solution {
+public:
+    /**
+     * Single-source BFS distances (the per-source baseline MS-BFS replaces).
+     */
+    vector<int> bfsDistances(vector<vector<int>>& adj, int src) {
+        int V = adj.size();
+        vector<int> dist(V, -1);
+        queue<int> q;
+        dist[src] = 0;
+        q.push(src);
+        while (!q.empty()) {
+            int node = q.front();
+            q.pop();
+            for (auto neighbor : adj[node]) {
+                if (dist[neighbor] == -1) {
+                    dist[neighbor] = dist[node] + 1;
+                    q.push(neighbor);
+                }
+            }
+        }
+        return dist;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    // TEST CASE SETUP: undirected path 0-1-2-3 plus branch 1-4.
+    int V = 5;
+    vector<vector<int>> adj = {{1}, {0, 2, 4}, {1, 3}, {2}, {1}};
+    vector<int> sources = {0, 3, 4};
+
+    cout << "INITIATING SWARM EXPLORATION PROTOCOL..." << endl;
+    MultiSourceBFS<64> swarm(adj);
+    vector<vector<int>> dist = swarm.distances(sources);
+    for (size_t i = 0; i < sources.size(); i++) {
+        cout << "Source " << sources[i] << " distances: [ ";
+        for (int v = 0; v < V; v++) cout << dist[i][v] << (v == V - 1 ? "" : ", ");
+        cout << " ]  eccentricity " << swarm.statistics({sources[i]})[0].eccentricity << endl;
+    }
+    // Expected: [0,1,2,3,2] ecc 3; [3,2,1,0,3] ecc 3; [2,1,2,3,0] ecc 3
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: S sources on a random small-world-ish graph ---
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+    int S = argc > 3 ? atoi(argv[3]) : 256;
+    mt19937 rng(33);
+    uniform_int_distribution<int> pick(0, n - 1);
+    vector<vector<int>> big(n);
+    for (int u = 0; u < n; u++) {
+        for (int k = 0; k < degree / 2; k++) {
+            int v = pick(rng);
+            big[u].push_back(v);
+            big[v].push_back(u);
+        }
+    }
+    vector<int> src(S);
+    for (int& s : src) s = pick(rng);
+
+    auto t0 = chrono::steady_clock::now();
+    vector<SourceStats> naive(S);
+    for (int i = 0; i < S; i++) {
+        vector<int> d = solver.bfsDistances(big, src[i]);
+        for (int x : d) {
+            if (x < 0) continue;
+            naive[i].reached++;
+            naive[i].distanceSum += x;
+            naive[i].eccentricity = max(naive[i].eccentricity, x);
+        }
+    }
+    auto t1 = chrono::steady_clock::now();
+    vector<SourceStats> ms64 = MultiSourceBFS<64>(big).statistics(src);
+    auto t2 = chrono::steady_clock::now();
+    vector<SourceStats> ms256 = MultiSourceBFS<256>(big).statistics(src);
+    auto t3 = chrono::steady_clock::now();
+
+    auto same = [&](const vector<SourceStats>& a) {
+        for (int i = 0; i < S; i++) {
+            if (a[i].reached != naive[i].reached || a[i].distanceSum != naive[i].distanceSum ||
+                a[i].eccentricity != naive[i].eccentricity) return false;
+        }
+        return true;
+    };
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    cout << "BENCHMARK: " << n << " vertices, ~" << (long long)n * degree << " arcs, " << S << " sources" << endl;
+    cout << fixed << setprecision(1);
+    cout << "  " << left << setw(26) << to_string(S) + " x single-source BFS" << right << ": " << setw(8) << ms(t0, t1) << " ms" << endl;
+    cout << "  MS-BFS, 64-bit masks      : " << setw(8) << ms(t1, t2) << " ms  ("
+         << ms(t0, t1) / ms(t1, t2) << "x) " << (same(ms64) ? "[verified]" : "[MISMATCH]") << endl;
+    cout << "  MS-BFS, 256-bit masks     : " << setw(8) << ms(t2, t3) << " ms  ("
+         << ms(t0, t1) / ms(t2, t3) << "x) " << (same(ms256) ? "[verified]" : "[MISMATCH]") << endl;
+    cout << "  closeness(source 0) = " << setprecision(4) << ms256[0].closeness()
+         << ", eccentricity = " << ms256[0].eccentricity << endl;
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,478 @@
+/**
+ * @file block_quick_sort.cpp
+ * @author LuShadowX
+ * @brief Pattern-defeating Quick Sort (pdqsort) with branchless block partitioning.
+ * @difficulty: Hard (Rank A)
+ * @tags: Sorting, Quick Sort, BlockQuicksort, pdqsort, Branch Prediction, Unstable Sort
+ * @logic: On random data the Dutch National Flag loop of Solution::partition3 (the
+ * 3-way partition of the introsort in Quick_Sort.c++) takes the branch
+ * "arr[i] < pivot" with probability 1/2, so roughly every comparison is a
+ * mispredict (~15 cycles each). BlockQuicksort (Edelkamp & Weiss) decouples
+ * comparing from moving:
+ * 1. SCAN: for a block of 64 elements on each side, write the offset of every
+ *    element that is on the wrong side into a small buffer. The write is
+ *    unconditional; only the buffer length grows by the comparison result
+ *    (offsets[num] = i; num += (x >= pivot)), so the loop has no data-dependent branch.
+ * 2. SWAP: pair up min(numL, numR) misplaced elements and swap them in one batch
+ *    (as a cyclic permutation: one temporary instead of three moves per swap).
+ * The pdqsort refinements (Peters, 2021) are layered on top:
+ * - Pivot: median-of-3, or pseudo-median of 9 above 128 elements.
+ * - Equal keys: if the pivot equals the element before the segment (a previous
+ *   pivot), everything <= pivot is split off and never touched again (O(N) for
+ *   few unique keys).
+ * - Patterns: if partitioning swapped nothing (input already partitioned), both
+ *   sides get a partial insertion sort that gives up after 8 moves; sorted and
+ *   nearly sorted runs finish in O(N).
+ * - Bad partitions (< 1/8 on one side) shuffle a few elements to break patterns;
+ *   after log2 N of them the segment is heapsorted (O(N log N) worst case).
+ * Measured trade-off: organ-pipe input (0 1 2 .. N/2 .. 2 1 0) is the one shape
+ * in the benchmark where this sort loses to quickSort: ~2x slower at N = 4M (168 vs
+ * 79 ms). std::sort is slow there too.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Branch Mispredictions]
+ * 3-way partition3: >= N/2 mispredicts per level on random input (two data-dependent
+ * branches per element).
+ * Block partition: O(N / B) mispredicts per level (loop exits only), B = 64.
+ *
+ * [Complexity]
+ * Time: O(N log N) average and worst case (heapsort after log2 N bad partitions).
+ * Best cases: O(N) on sorted, reversed or all-equal input, and O(N k) with k
+ * distinct keys.
+ *
+ * [Space Complexity]
+ * O(log N) stack plus two 64-byte offset buffers per active partition.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Branchless Partition Protocol
+ * RANK: A (Architecture-Aware Sorting)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort integer arrays faster than the introsort quickSort (3-way partition3) by removing
+ * data-dependent branches from the partition loop, while staying O(N) on
+ * presorted and duplicate-heavy inputs.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N) worst case.
+ * - Space Complexity: O(log N) stack.
+ * - Stability: Unstable sort.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace std;
+
+class Solution {
+private:
+    static constexpr int INSERTION_SORT_THRESHOLD = 24;
+    static constexpr int NINTHER_THRESHOLD = 128;
+    static constexpr int PARTIAL_INSERTION_SORT_LIMIT = 8;
+    static constexpr int BLOCK_SIZE = 64;   // Offsets fit in one byte; one buffer per cache line
+
+    static void insertionSort(int* begin, int* end) {
+        for (int* cur = begin + 1; cur < end; cur++) {
+            int key = *cur;
+            int* sift = cur;
+            while (sift != begin && key < sift[-1]) {
+                *sift = sift[-1];
+                sift--;
+            }
+            *sift = key;
+        }
+    }
+
+    /**
+     * Insertion sort without the lower bound check: valid when begin[-1] is <= every
+     * element of the segment (true for every segment except the leftmost one).
+     */
+    static void unguardedInsertionSort(int* begin, int* end) {
+        for (int* cur = begin + 1; cur < end; cur++) {
+            int key = *cur;
+            int* sift = cur;
+            while (key < sift[-1]) {
+                *sift = sift[-1];
+                sift--;
+            }
+            *sift = key;
+        }
+    }
+
+    /**
+     * THE PATTERN DETECTOR
+     * Insertion sort that gives up once more than PARTIAL_INSERTION_SORT_LIMIT
+     * elements have been moved. Returns true if the segment ended up sorted.
+     */
+    static bool partialInsertionSort(int* begin, int* end) {
+        if (begin == end) return true;
+        long moved = 0;
+        for (int* cur = begin + 1; cur < end; cur++) {
+            if (*cur < cur[-1]) {
+                int key = *cur;
+                int* sift = cur;
+                do {
+                    *sift = sift[-1];
+                    sift--;
+                } while (sift != begin && key < sift[-1]);
+                *sift = key;
+                moved += cur - sift;
+            }
+            if (moved > PARTIAL_INSERTION_SORT_LIMIT) return false;
+        }
+        return true;
+    }
+
+    static void sort2(int* a, int* b) {
+        if (*b < *a) swap(*a, *b);
+    }
+
+    static void sort3(int* a, int* b, int* c) {
+        sort2(a, b);
+        sort2(b, c);
+        sort2(a, b);
+    }
+
+    static void siftDown(int* a, int root, int n) {
+        int value = a[root];
+        while (2 * root + 1 < n) {
+            int child = 2 * root + 1;
+            if (child + 1 < n && a[child] < a[child + 1]) child++;
+            if (a[child] <= value) break;
+            a[root] = a[child];
+            root = child;
+        }
+        a[root] = value;
+    }
+
+    static void heapSort(int* begin, int* end) {
+        int n = end - begin;
+        for (int i = n / 2 - 1; i >= 0; i--) siftDown(begin, i, n);
+        for (int last = n - 1; last > 0; last--) {
+            swap(begin[0], begin[last]);
+            siftDown(begin, 0, last);
+        }
+    }
+
+    /**
+     * THE BATCH SWAPPER
+     * Exchanges first[offsetsL[i]] with last[-offsetsR[i]] for i < num. With
+     * useSwaps == false the exchanges are done as one cyclic permutation.
+     */
+    static void swapOffsets(int* first, int* last, const unsigned char* offsetsL,
+                            const unsigned char* offsetsR, int num, bool useSwaps) {
+        if (useSwaps) {
+            // Plain swaps when both buffers are full: needed to keep descending input O(N).
+            for (int i = 0; i < num; i++) swap(first[offsetsL[i]], *(last - offsetsR[i]));
+        } else if (num > 0) {
+            int* l = first + offsetsL[0];
+            int* r = last - offsetsR[0];
+            int tmp = *l;
+            *l = *r;
+            for (int i = 1; i < num; i++) {
+                l = first + offsetsL[i];
+                *r = *l;
+                r = last - offsetsR[i];
+                *l = *r;
+            }
+            *r = tmp;
+        }
+    }
+
+    /**
+     * THE BLOCK PARTITIONER (Branchless)
+     * Partitions [begin, end) around *begin into [ < pivot | pivot | >= pivot ].
+     * @return {pivot position, true if no element had to move}.
+     */
+    static pair<int*, bool> partitionRightBranchless(int* begin, int* end) {
+        int pivot = *begin;
+        int* first = begin;
+        int* last = end;
+
+        // The median-of-3 guarantees both scans stop inside the segment.
+        while (*++first < pivot) {}
+        if (first - 1 == begin) {
+            while (first < last && !(*--last < pivot)) {}
+        } else {
+            while (!(*--last < pivot)) {}
+        }
+
+        bool alreadyPartitioned = first >= last;
+        if (!alreadyPartitioned) {
+            swap(*first, *last);
+            first++;
+
+            alignas(64) unsigned char offsetsL[BLOCK_SIZE];
+            alignas(64) unsigned char offsetsR[BLOCK_SIZE];
+            int* offsetsLBase = first;
+            int* offsetsRBase = last;
+            int numL = 0, numR = 0, startL = 0, startR = 0;
+
+            while (first < last) {
+                // How many unknown elements each side scans in this round.
+                int numUnknown = last - first;
+                int leftSplit = numL == 0 ? (numR == 0 ? numUnknown / 2 : numUnknown) : 0;
+                int rightSplit = numR == 0 ? (numUnknown - leftSplit) : 0;
+
+                // SCAN: record offsets of misplaced elements, no branch on the data.
+                if (leftSplit >= BLOCK_SIZE) {
+                    for (int i = 0; i < BLOCK_SIZE; i++) {
+                        offsetsL[numL] = i;
+                        numL += !(*first < pivot);
+                        first++;
+                    }
+                } else {
+                    for (int i = 0; i < leftSplit; i++) {
+                        offsetsL[numL] = i;
+                        numL += !(*first < pivot);
+                        first++;
+                    }
+                }
+                if (rightSplit >= BLOCK_SIZE) {
+                    for (int i = 1; i <= BLOCK_SIZE; i++) {
+                        offsetsR[numR] = i;
+                        numR += *--last < pivot;
+                    }
+                } else {
+                    for (int i = 1; i <= rightSplit; i++) {
+                        offsetsR[numR] = i;
+                        numR += *--last < pivot;
+                    }
+                }
+
+                // SWAP: pair misplaced elements from both buffers.
+                int num = min(numL, numR);
+                swapOffsets(offsetsLBase, offsetsRBase, offsetsL + startL, offsetsR + startR, num, numL == numR);
+                numL -= num;
+                numR -= num;
+                startL += num;
+                startR += num;
+                if (numL == 0) {
+                    startL = 0;
+                    offsetsLBase = first;
+                }
+                if (numR == 0) {
+                    startR = 0;
+                    offsetsRBase = last;
+                }
+            }
+
+            // Leftovers from one buffer are moved to the boundary one by one.
+            if (numL) {
+                while (numL--) swap(offsetsLBase[offsetsL[startL + numL]], *--last);
+                first = last;
+            }
+            if (numR) {
+                while (numR--) swap(*(offsetsRBase - offsetsR[startR + numR]), *first), first++;
+                last = first;
+            }
+        }
+
+        int* pivotPos = first - 1;
+        *begin = *pivotPos;
+        *pivotPos = pivot;
+        return {pivotPos, alreadyPartitioned};
+    }
+
+    /**
+     * THE EQUAL-KEY SPLITTER
+     * Partitions [begin, end) around *begin into [ <= pivot | > pivot ]. Used when
+     * the pivot equals the previous pivot, so the left side is all equal keys.
+     */
+    static int* partitionLeft(int* begin, int* end) {
+        int pivot = *begin;
+        int* first = begin;
+        int* last = end;
+
+        while (pivot < *--last) {}
+        if (last + 1 == end) {
+            while (first < last && !(pivot < *++first)) {}
+        } else {
+            while (!(pivot < *++first)) {}
+        }
+        while (first < last) {
+            swap(*first, *last);
+            while (pivot < *--last) {}
+            while (!(pivot < *++first)) {}
+        }
+
+        int* pivotPos = last;
+        *begin = *pivotPos;
+        *pivotPos = pivot;
+        return pivotPos;
+    }
+
+    /**
+     * THE PDQ LOOP
+     * Recurses on the left part, loops on the right part.
+     */
+    static void pdqLoop(int* begin, int* end, int badAllowed, bool leftmost) {
+        while (true) {
+            int size = end - begin;
+            if (size < INSERTION_SORT_THRESHOLD) {
+                if (leftmost) insertionSort(begin, end);
+                else unguardedInsertionSort(begin, end);
+                return;
+            }
+
+            // PIVOT: moved to *begin.
+            int s2 = size / 2;
+            if (size > NINTHER_THRESHOLD) {
+                sort3(begin, begin + s2, end - 1);
+                sort3(begin + 1, begin + (s2 - 1), end - 2);
+                sort3(begin + 2, begin + (s2 + 1), end - 3);
+                sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1));
+                swap(*begin, begin[s2]);
+            } else {
+                sort3(begin + s2, begin, end - 1);
+            }
+
+            // EQUAL KEYS: pivot == previous pivot -> everything <= pivot is done.
+            if (!leftmost && !(begin[-1] < *begin)) {
+                begin = partitionLeft(begin, end) + 1;
+                continue;
+            }
+
+            pair<int*, bool> part = partitionRightBranchless(begin, end);
+            int* pivotPos = part.first;
+            int lSize = pivotPos - begin;
+            int rSize = end - (pivotPos + 1);
+
+            if (lSize < size / 8 || rSize < size / 8) {
+                // BAD PARTITION: fall back to heapsort, or shuffle to break the pattern.
+                if (--badAllowed == 0) {
+                    heapSort(begin, end);
+                    return;
+                }
+                if (lSize >= INSERTION_SORT_THRESHOLD) {
+                    swap(begin[0], begin[lSize / 4]);
+                    swap(pivotPos[-1], *(pivotPos - lSize / 4));
+                    if (lSize > NINTHER_THRESHOLD) {
+                        swap(begin[1], begin[lSize / 4 + 1]);
+                        swap(begin[2], begin[lSize / 4 + 2]);
+                        swap(pivotPos[-2], *(pivotPos - (lSize / 4 + 1)));
+                        swap(pivotPos[-3], *(pivotPos - (lSize / 4 + 2)));
+                    }
+                }
+                if (rSize >= INSERTION_SORT_THRESHOLD) {
+                    swap(pivotPos[1], pivotPos[1 + rSize / 4]);
+                    swap(end[-1], *(end - rSize / 4));
+                    if (rSize > NINTHER_THRESHOLD) {
+                        swap(pivotPos[2], pivotPos[2 + rSize / 4]);
+                        swap(pivotPos[3], pivotPos[3 + rSize / 4]);
+                        swap(end[-2], *(end - (1 + rSize / 4)));
+                        swap(end[-3], *(end - (2 + rSize / 4)));
+                    }
+                }
+            } else if (part.second && partialInsertionSort(begin, pivotPos) &&
+                       partialInsertionSort(pivotPos + 1, end)) {
+                // PATTERN: nothing moved and both sides are (nearly) sorted.
+                return;
+            }
+
+            pdqLoop(begin, pivotPos, badAllowed, leftmost);
+            begin = pivotPos + 1;
+            leftmost = false;
+        }
+    }
+
+public:
+    /**
+     * THE BLOCK DRIVER
+     * Sorts arr[low..high] with pdqsort + branchless block partitioning.
+     * @param arr The vector to be sorted.
+     * @param low The starting index of the segment.
+     * @param high The ending index of the segment (inclusive).
+     */
+    void blockQuickSort(vector<int>& arr, int low, int high) {
+        if (low >= high) return;
+        int n = high - low + 1;
+        int badAllowed = 0;
+        while (n > 0) {   // floor(log2 N) + 1
+            badAllowed++;
+            n >>= 1;
+        }
+        pdqLoop(arr.data() + low, arr.data() + high + 1, badAllowed, true);
+    }
+};
+
+// Quick_Sort.c++ includes the sorting network; the guarded file is compiled here,
+// at global scope, and skipped inside quick_sort_impl.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// The current introsort quickSort (3-way partition3), compiled unchanged for the comparison.
+#pragma push_macro("main")
+#undef main
+#define main quick_sort_demo_main
+namespace quick_sort_impl {
+#include "Quick_Sort.c++"
+}
+#pragma pop_macro("main")
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
+    vector<int> data = {4, 2, 8, 3, 1, 5, 7, 1, -2, 4};
+    int N = data.size();
+
+    cout << "INITIATING BRANCHLESS PARTITION PROTOCOL..." << endl;
+    printArray(data);
+    solver.blockQuickSort(data, 0, N - 1);
+    printArray(data);
+    // Expected Output: [ -2, 1, 1, 2, 3, 4, 4, 5, 7, 8 ]
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: std::sort vs quickSort (Quick_Sort.c++) vs blockQuickSort ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    mt19937 rng(40);
+    quick_sort_impl::Solution introsort;
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    // Expect blockQuickSort to win everywhere except organ pipe (see @logic).
+    cout << "BENCHMARK (N=" << n << ", ms): std::sort / quickSort / blockQuickSort" << endl;
+    for (string kind : {"random", "sorted", "reversed", "nearly sorted", "few unique", "organ pipe"}) {
+        vector<int> base(n);
+        for (int i = 0; i < n; i++) {
+            base[i] = kind == "random" ? (int)rng() : kind == "reversed" ? n - i
+                    : kind == "few unique" ? (int)(rng() % 16) : kind == "organ pipe" ? min(i, n - i) : i;
+        }
+        if (kind == "nearly sorted") {
+            for (int k = 0; k < n / 100; k++) swap(base[rng() % n], base[rng() % n]);
+        }
+        vector<int> a = base, b = base, c = base;
+        auto t0 = chrono::steady_clock::now();
+        sort(a.begin(), a.end());
+        auto t1 = chrono::steady_clock::now();
+        introsort.quickSort(b, 0, n - 1);
+        auto t2 = chrono::steady_clock::now();
+        solver.blockQuickSort(c, 0, n - 1);
+        auto t3 = chrono::steady_clock::now();
+        cout << "  " << kind << ": " << ms(t0, t1) << " / " << ms(t1, t2) << " / " << ms(t2, t3)
+             << ((b == a && c == a) ? " [verified]" : " [MISMATCH]") << endl;
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,478 @@
+/**
+ * @file external_merge_sort.cpp
+ * @author LuShadowX
+ * @brief External-memory merge sort for binary files of 32-bit integers larger than RAM.
+ * @difficulty: Hard (Rank S)
+ * @tags: Sorting, External Sorting, Merge Sort, Loser Tree, Asynchronous I/O, Parallel Algorithms
+ * @logic: Solution::mergeSort needs the whole vector<int> in memory. For files
+ * several times larger than RAM the classic two-phase external sort is used:
+ * 1. RUN FORMATION: read the file in chunks of at most memoryBytes / 3 (read buffer,
+ *    sort buffer, sorter scratch). Sort each chunk with the parallel quicksort of
+ *    Parallel_Quick_Sort.c++ and spill it to tempDir as a sorted run. The read of
+ *    chunk i + 1 runs asynchronously while chunk i is sorted and written.
+ * 2. K-WAY MERGE: a loser tree picks the smallest head among k runs with
+ *    ceil(log2 k) comparisons per element. Every run has two input blocks: one is
+ *    consumed while the next is prefetched by an async read. The output is also
+ *    double-buffered: one block is written asynchronously while the next fills.
+ *    If there are more runs than the memory budget allows (fan-in), intermediate
+ *    passes merge groups of runs into longer runs first.
+ * Limits are explicit: memoryBytes caps every buffer, maxTempBytes caps the spill
+ * volume (exceeding it throws), and tempDir chooses the spill device.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [I/O Complexity] (Aggarwal & Vitter) for N elements, memory M, block B:
+ *   Runs after phase 1: R = ceil(N / (M / 3)).
+ *   Merge passes: ceil(log_F R), with fan-in F = M / (2B) - 1 (two blocks per
+ *   input run, two for the output).
+ *   Total I/O: 2N * (1 + ceil(log_F R)) element transfers.
+ *   Example: 10x RAM gives R = 30. With 1 MB blocks and 1 GB of RAM, F is about 500,
+ *   so one merge pass suffices and each byte is read twice and written twice.
+ *
+ * [Loser Tree]
+ *   Internal nodes store the loser of each match and node 0 stores the overall
+ *   winner. Replacing the winner replays only its leaf-to-root path:
+ *   ceil(log2 k) comparisons (a binary heap needs up to 2 log2 k).
+ *
+ * [Space Complexity] O(M) RAM, O(N) temporary disk (two generations at most).
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Out-of-Core Sorting Protocol
+ * RANK: S (External Memory Algorithms)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort a binary file of native-endian int32 values that is many times larger than
+ * RAM, keeping both disk directions and all cores busy.
+ * CONSTRAINTS:
+ * - I/O: 2N (1 + ceil(log_F R)) element transfers.
+ * - Memory: bounded by ExternalSortConfig::memoryBytes.
+ * - Disk: bounded by ExternalSortConfig::maxTempBytes (0 = unlimited).
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace std;
+
+// Base case of the nested quickSort; it must be compiled at global scope.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// The parallel in-memory sorter used for run formation.
+#pragma push_macro("main")
+#undef main
+#define main parallel_quick_sort_demo_main
+namespace parallel_quick_sort_impl {
+#include "Parallel_Quick_Sort.c++"
+}
+#pragma pop_macro("main")
+
+struct ExternalSortConfig {
+    size_t memoryBytes = 256u << 20;      // RAM budget for all buffers
+    size_t blockBytes = 1u << 20;         // I/O block size per run buffer during merging
+    string tempDir = "/tmp";              // Directory for spilled runs
+    unsigned long long maxTempBytes = 0;  // Spill volume limit (0 = unlimited)
+    int threads = 0;                      // Sorter threads (0 = hardware concurrency)
+};
+
+struct ExternalSortStats {
+    long long elements = 0;
+    int initialRuns = 0;
+    int mergePasses = 0;
+    double runSeconds = 0, mergeSeconds = 0;
+};
+
+/**
+ * Sorted run on disk.
+ */
+struct Run {
+    string path;
+    long long count;
+};
+
+/**
+ * Sequential reader with one block in use and one block in flight.
+ */
+class RunReader {
+private:
+    FILE* file;
+    vector<int> buf[2];
+    size_t len[2] = {0, 0};
+    int cur = 0;
+    size_t pos = 0;
+    future<size_t> pending;
+
+    void prefetch() {
+        int other = cur ^ 1;
+        pending = async(launch::async, [this, other] {
+            return fread(buf[other].data(), sizeof(int), buf[other].size(), file);
+        });
+    }
+
+public:
+    RunReader(const string& path, size_t blockElems) {
+        file = fopen(path.c_str(), "rb");
+        if (!file) throw runtime_error("cannot open run " + path);
+        buf[0].resize(blockElems);
+        buf[1].resize(blockElems);
+        len[0] = fread(buf[0].data(), sizeof(int), blockElems, file);
+        if (len[0] > 0) prefetch();
+    }
+
+    ~RunReader() {
+        if (pending.valid()) pending.wait();
+        fclose(file);
+    }
+
+    bool exhausted() const { return pos >= len[cur]; }
+    int head() const { return buf[cur][pos]; }
+
+    void advance() {
+        if (++pos < len[cur]) return;
+        // Block consumed: switch to the prefetched one and start the next read.
+        len[cur ^ 1] = pending.get();
+        cur ^= 1;
+        pos = 0;
+        if (len[cur] > 0) prefetch();
+    }
+};
+
+/**
+ * Sequential writer: fills one block while the previous one is being written.
+ */
+class BlockWriter {
+private:
+    FILE* file;
+    string path;
+    vector<int> buf[2];
+    size_t fill = 0;
+    int cur = 0;
+    future<size_t> pending;
+
+    void flush() {
+        if (pending.valid() && pending.get() == 0) throw runtime_error("write failed: " + path);
+        if (fill == 0) return;
+        int block = cur;
+        size_t n = fill;
+        pending = async(launch::async, [this, block, n] {
+            return fwrite(buf[block].data(), sizeof(int), n, file) == n ? n : 0;
+        });
+        cur ^= 1;
+        fill = 0;
+    }
+
+public:
+    BlockWriter(const string& path, size_t blockElems) : path(path) {
+        file = fopen(path.c_str(), "wb");
+        if (!file) throw runtime_error("cannot create " + path);
+        buf[0].resize(blockElems);
+        buf[1].resize(blockElems);
+    }
+
+    void push(int x) {
+        buf[cur][fill++] = x;
+        if (fill == buf[cur].size()) flush();
+    }
+
+    void close() {
+        flush();
+        if (pending.valid() && pending.get() == 0) throw runtime_error("write failed: " + path);
+        fclose(file);
+        file = nullptr;
+    }
+
+    ~BlockWriter() {
+        if (pending.valid()) pending.wait();
+        if (file) fclose(file);
+    }
+};
+
+/**
+ * Tournament tree of losers over k sources; node 0 holds the overall winner.
+ */
+class LoserTree {
+private:
+    int k;
+    vector<int> node;                 // node[1..k-1]: losers; node[0]: winner
+    vector<RunReader*>& sources;
+
+    // Exhausted sources lose against everything.
+    bool beats(int a, int b) const {
+        if (sources[a]->exhausted()) return false;
+        if (sources[b]->exhausted()) return true;
+        return sources[a]->head() < sources[b]->head() || (sources[a]->head() == sources[b]->head() && a < b);
+    }
+
+public:
+    explicit LoserTree(vector<RunReader*>& sources) : k(sources.size()), node(max(1, (int)sources.size())), sources(sources) {
+        // Bottom-up tournament on the implicit tree whose leaves are k..2k-1.
+        vector<int> winner(2 * k);
+        for (int i = 0; i < k; i++) winner[k + i] = i;
+        for (int t = k - 1; t >= 1; t--) {
+            int a = winner[2 * t], b = winner[2 * t + 1];
+            winner[t] = beats(a, b) ? a : b;
+            node[t] = beats(a, b) ? b : a;
+        }
+        node[0] = k == 1 ? 0 : winner[1];
+    }
+
+    int winner() const { return node[0]; }
+
+    /**
+     * REPLAY: the winner's source advanced; rerun the matches on its path to the root.
+     */
+    void replay() {
+        int w = node[0];
+        for (int t = (w + k) / 2; t >= 1; t /= 2) {
+            if (beats(node[t], w)) swap(node[t], w);
+        }
+        node[0] = w;
+    }
+};
+
+class Solution {
+private:
+    ExternalSortConfig config;
+    unsigned long long spilled = 0;
+    int runId = 0;
+
+    string tempPath() {
+        return config.tempDir + "/extsort_" + to_string(getpid()) + "_" + to_string(runId++) + ".run";
+    }
+
+    void chargeTemp(unsigned long long bytes) {
+        spilled += bytes;
+        if (config.maxTempBytes && spilled > config.maxTempBytes) {
+            throw runtime_error("temporary space limit exceeded (" + to_string(spilled) + " > " +
+                                to_string(config.maxTempBytes) + " bytes)");
+        }
+    }
+
+    static void removeRuns(const vector<Run>& runs) {
+        for (const Run& r : runs) remove(r.path.c_str());
+    }
+
+    /**
+     * PHASE 1: sorted runs of memoryBytes / 3 bytes each, at most INT_MAX elements
+     * (the in-memory sorter takes int indices).
+     * On any error the input is closed and every run spilled so far is deleted.
+     */
+    vector<Run> formRuns(const string& input, ExternalSortStats& stats) {
+        FILE* in = fopen(input.c_str(), "rb");
+        if (!in) throw runtime_error("cannot open input " + input);
+        size_t chunk = min<size_t>(INT_MAX, max<size_t>(1024, config.memoryBytes / 3 / sizeof(int)));
+
+        vector<Run> runs;
+        future<size_t> nextRead;
+        try {
+            vector<int> cur(chunk), next(chunk);
+            parallel_quick_sort_impl::Solution sorter(config.threads > 0 ? config.threads
+                                                                          : max(1u, thread::hardware_concurrency()));
+
+            size_t got = fread(cur.data(), sizeof(int), chunk, in);
+            while (got > 0) {
+                // Read chunk i + 1 while chunk i is sorted and spilled.
+                nextRead = async(launch::async, [&] { return fread(next.data(), sizeof(int), chunk, in); });
+
+                cur.resize(got);
+                sorter.quickSort(cur, 0, (int)got - 1);
+                chargeTemp(got * sizeof(int));
+                string path = tempPath();
+                FILE* out = fopen(path.c_str(), "wb");
+                bool ok = out && fwrite(cur.data(), sizeof(int), got, out) == got;
+                if (out) fclose(out);
+                if (!ok) {
+                    remove(path.c_str());
+                    throw runtime_error("cannot write run " + path);
+                }
+                runs.push_back({path, (long long)got});
+                stats.elements += got;
+
+                got = nextRead.get();
+                cur.resize(chunk);
+                swap(cur, next);
+            }
+        } catch (...) {
+            if (nextRead.valid()) nextRead.wait();   // The read still uses 'in'
+            fclose(in);
+            removeRuns(runs);
+            throw;
+        }
+        fclose(in);
+        return runs;
+    }
+
+    /**
+     * K-WAY MERGE of 'group' into 'output' through a loser tree.
+     */
+    void mergeRuns(const vector<Run>& group, const string& output, size_t blockElems) {
+        vector<unique_ptr<RunReader>> owned;
+        vector<RunReader*> readers;
+        for (const Run& r : group) {
+            owned.push_back(make_unique<RunReader>(r.path, blockElems));
+            readers.push_back(owned.back().get());
+        }
+        BlockWriter out(output, blockElems);
+        LoserTree tree(readers);
+        while (!readers[tree.winner()]->exhausted()) {
+            RunReader* w = readers[tree.winner()];
+            out.push(w->head());
+            w->advance();
+            tree.replay();
+        }
+        out.close();
+    }
+
+public:
+    explicit Solution(ExternalSortConfig config = {}) : config(config) {}
+
+    /**
+     * THE OUT-OF-CORE DRIVER
+     * Sorts the int32 file 'input' into 'output'.
+     */
+    ExternalSortStats externalSort(const string& input, const string& output) {
+        ExternalSortStats stats;
+        spilled = 0;
+
+        auto t0 = chrono::steady_clock::now();
+        vector<Run> runs = formRuns(input, stats);
+        auto t1 = chrono::steady_clock::now();
+        stats.runSeconds = chrono::duration<double>(t1 - t0).count();
+        stats.initialRuns = runs.size();
+
+        if (runs.empty()) {
+            BlockWriter(output, 1).close();   // Empty input -> empty output
+            return stats;
+        }
+
+        // FAN-IN: two blocks per input run plus two for the output must fit in memory.
+        size_t blockElems = max<size_t>(1024, config.blockBytes / sizeof(int));
+        int fanIn = max<long long>(2, (long long)(config.memoryBytes / (2 * blockElems * sizeof(int))) - 1);
+
+        // INTERMEDIATE PASSES: merge groups until one final merge suffices.
+        // On failure every remaining run (and the partial output) is deleted.
+        vector<Run> merged;
+        try {
+            while ((int)runs.size() > fanIn) {
+                for (size_t i = 0; i < runs.size(); i += fanIn) {
+                    vector<Run> group(runs.begin() + i, runs.begin() + min(runs.size(), i + fanIn));
+                    long long count = 0;
+                    for (const Run& r : group) count += r.count;
+                    chargeTemp(count * sizeof(int));
+                    merged.push_back({tempPath(), count});   // Registered first: a failed merge removes it
+                    mergeRuns(group, merged.back().path, blockElems);
+                    for (const Run& r : group) {
+                        remove(r.path.c_str());
+                        spilled -= r.count * sizeof(int);
+                    }
+                }
+                runs.swap(merged);
+                merged.clear();
+                stats.mergePasses++;
+            }
+
+            mergeRuns(runs, output, blockElems);
+        } catch (...) {
+            removeRuns(runs);   // Already-merged inputs are gone; remove() just fails on them
+            removeRuns(merged);
+            remove(output.c_str());
+            throw;
+        }
+        removeRuns(runs);
+        stats.mergePasses++;
+        stats.mergeSeconds = chrono::duration<double>(chrono::steady_clock::now() - t1).count();
+        return stats;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+int main(int argc, char** argv) {
+    // Usage: ./a.out [N] [memoryMB] [tempDir] [blockKB]
+    long long n = argc > 1 ? atoll(argv[1]) : 1 << 24;
+    ExternalSortConfig config;
+    config.memoryBytes = (size_t)(argc > 2 ? atof(argv[2]) : 8) * (1 << 20);
+    config.tempDir = argc > 3 ? argv[3] : "/tmp";
+    config.blockBytes = (size_t)(argc > 4 ? atoi(argv[4]) : 64) << 10;
+
+    string input = config.tempDir + "/extsort_input.bin";
+    string output = config.tempDir + "/extsort_output.bin";
+
+    cout << "INITIATING OUT-OF-CORE SORTING PROTOCOL..." << endl;
+
+    // TEST DATA: N random ints (file is N * 4 bytes, far above the memory budget).
+    mt19937 rng(44);
+    long long checksum = 0;
+    {
+        FILE* f = fopen(input.c_str(), "wb");
+        vector<int> block(1 << 16);
+        for (long long done = 0; done < n; done += block.size()) {
+            size_t m = min<long long>(block.size(), n - done);
+            for (size_t i = 0; i < m; i++) {
+                block[i] = (int)rng();
+                checksum += block[i];
+            }
+            fwrite(block.data(), sizeof(int), m, f);
+        }
+        fclose(f);
+    }
+    cout << "Input: " << n << " ints (" << n * 4 / (1 << 20) << " MB), memory budget "
+         << config.memoryBytes / (1 << 20) << " MB" << endl;
+
+    ExternalSortStats stats = Solution(config).externalSort(input, output);
+
+    // VERIFY: sorted, same length, same checksum.
+    bool sorted = true;
+    long long count = 0, outSum = 0;
+    {
+        FILE* f = fopen(output.c_str(), "rb");
+        vector<int> block(1 << 16);
+        int prev = INT32_MIN;
+        for (size_t m; (m = fread(block.data(), sizeof(int), block.size(), f)) > 0;) {
+            for (size_t i = 0; i < m; i++) {
+                sorted &= block[i] >= prev;
+                prev = block[i];
+                outSum += block[i];
+            }
+            count += m;
+        }
+        fclose(f);
+    }
+
+    double mb = n * 4.0 / (1 << 20);
+    cout << "  Run formation : " << stats.runSeconds << " s (" << mb / stats.runSeconds << " MB/s), "
+         << stats.initialRuns << " runs" << endl;
+    cout << "  K-way merge   : " << stats.mergeSeconds << " s (" << mb * stats.mergePasses / stats.mergeSeconds
+         << " MB/s), " << stats.mergePasses << " pass(es)" << endl;
+    cout << "  Output " << ((sorted && count == n && outSum == checksum) ? "[verified]" : "[MISMATCH]") << endl;
+    remove(input.c_str());
+    remove(output.c_str());
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
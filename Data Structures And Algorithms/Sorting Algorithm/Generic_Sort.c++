@@ -0,0 +1,440 @@
+/**
+ * @file generic_sort.cpp
+ * @author LuShadowX
+ * @brief Iterator/comparator/projection templates of merge sort and quicksort, plus a
+ * struct-of-arrays mode that sorts a key column and permutes payload columns.
+ * @difficulty: Medium-Hard (Rank A)
+ * @tags: Sorting, Templates, Generic Programming, Merge Sort, Introsort, SoA
+ * @logic: The vector<int> sorts in this folder are rewritten over iterators:
+ * - Order: comp(proj(a), proj(b)) through std::invoke, so records sort by a field
+ *   (&Trade::price), a lambda, or a member function, in place, with no pointer or
+ *   index indirection. Compare and Projection are template parameters held by
+ *   value in ProjectedLess, so for lambdas and member pointers the call inlines
+ *   and the generated code matches the hand-written vector<int> loops.
+ * - mergeSort: stable. Ping-pong between the range and one buffer (as in
+ *   MergeSort.c++), insertion cutoff, merge skipped when the halves are in order.
+ * - quickSort: introsort (as in Quick_Sort.c++): median-of-3 / ninther pivot,
+ *   3-way partition, smaller side first, heapsort below the depth limit.
+ * - Base case: an ascending sort of contiguous ints (vector<int> iterators or int*,
+ *   plain less, no projection) hands segments of up to 64 to the SIMD sorting
+ *   network, exactly as the vector<int> originals do. Any other type or order keeps
+ *   insertion sort.
+ * - sortColumns (SoA): sorts (key, row) pairs once, then gathers the key column and
+ *   every payload column in a single pass over the permutation. Payloads never move
+ *   during the sort, so wide rows cost one move each instead of log N.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [mergeSort] T(N) = 2T(N/2) + O(N) -> O(N log N) always; O(N) buffer; stable.
+ * [quickSort] O(N log N) expected and worst case (2 floor(log2 N) depth limit);
+ * O(log N) stack; unstable.
+ *
+ * [sortColumns] with C payload columns of row width W bytes:
+ * AoS sort moves N log N rows of W bytes.
+ * SoA sort moves N log N (key, row) pairs, then N * C payload elements once.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Universal Ordering Protocol
+ * RANK: A (Generic Sorting)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort arbitrary records by a projected key with the same machine code quality as
+ * the int-only sorts, and sort column stores without materializing rows.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N).
+ * - Space Complexity: O(N) for mergeSort / sortColumns, O(log N) for quickSort.
+ * - Stability: mergeSort and sortColumns are stable; quickSort is not.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+
+using namespace std;
+
+// SIMD base case for ascending int ranges. Included here, at global scope, so the
+// copies MergeSort.c++ and Quick_Sort.c++ pull in below are skipped by its guard.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// The vector<int> originals, for the zero-overhead comparison in main.
+#pragma push_macro("main")
+#undef main
+#define main merge_sort_demo_main
+namespace merge_sort_impl {
+#include "MergeSort.c++"
+}
+#undef main
+#define main quick_sort_demo_main
+namespace quick_sort_impl {
+#include "Quick_Sort.c++"
+}
+#pragma pop_macro("main")
+
+// Identity projection (std::identity is C++20).
+struct Identity {
+    template <typename T>
+    constexpr T&& operator()(T&& t) const noexcept { return forward<T>(t); }
+};
+
+/**
+ * comp(proj(a), proj(b)) as one callable; both are stored by value and inline.
+ */
+template <typename Compare, typename Projection>
+struct ProjectedLess {
+    Compare comp;
+    Projection proj;
+
+    template <typename A, typename B>
+    bool operator()(A&& a, B&& b) {
+        return invoke(comp, invoke(proj, forward<A>(a)), invoke(proj, forward<B>(b)));
+    }
+};
+
+class Solution {
+private:
+    static constexpr int MERGE_INSERTION_CUTOFF = 24;   // As in MergeSort.c++
+    static constexpr int QUICK_INSERTION_CUTOFF = 16;   // As in Quick_Sort.c++
+    static constexpr int NETWORK_CUTOFF = 64;           // SIMD base case, as in both
+    static constexpr int NINTHER_THRESHOLD = 40;
+
+    using Network = sorting_network_impl::Solution;
+
+    Network network;     // Base-case sorter for ascending int ranges
+    int networkCutoff;   // NETWORK_CUTOFF, or 0 when the CPU has no SIMD network
+
+    // The network sorts contiguous ints ascending: plain less over int elements only.
+    template <typename It, typename Less>
+    static constexpr bool NETWORK_BASE =
+        is_same_v<typename iterator_traits<It>::value_type, int> &&
+        (is_pointer_v<It> || is_same_v<It, vector<int>::iterator>) &&
+        (is_same_v<Less, ProjectedLess<less<>, Identity>> || is_same_v<Less, ProjectedLess<less<int>, Identity>>);
+
+    // Segments of at most this many elements go to sortBase.
+    template <typename It, typename Less>
+    ptrdiff_t baseCutoff(ptrdiff_t insertionCutoff) const {
+        if constexpr (NETWORK_BASE<It, Less>) {
+            return networkCutoff ? networkCutoff : insertionCutoff;
+        } else {
+            return insertionCutoff;
+        }
+    }
+
+    template <typename It, typename Less>
+    void sortBase(It first, It last, Less& lessThan) const {
+        if constexpr (NETWORK_BASE<It, Less>) {
+            if (networkCutoff) {
+                if (last - first >= 2) network.sortSmall(&*first, int(last - first));
+                return;
+            }
+        }
+        insertionSort(first, last, lessThan);
+    }
+
+    template <typename It, typename Less>
+    static void insertionSort(It first, It last, Less& lessThan) {
+        if (first == last) return;
+        for (It i = next(first); i != last; ++i) {
+            auto key = move(*i);
+            It j = i;
+            while (j != first) {
+                It k = prev(j);
+                if (!lessThan(key, *k)) break;
+                *j = move(*k);
+                j = k;
+            }
+            *j = move(key);
+        }
+    }
+
+    // ---------------- merge sort ----------------
+
+    /**
+     * THE MERGER
+     * Stable merge of [a, aEnd) and [b, bEnd) into out (ties from the left).
+     */
+    template <typename SrcIt, typename DstIt, typename Less>
+    static void mergeRuns(SrcIt a, SrcIt aEnd, SrcIt b, SrcIt bEnd, DstIt out, Less& lessThan) {
+        while (a != aEnd && b != bEnd) {
+            if (lessThan(*b, *a)) *out++ = move(*b++);
+            else *out++ = move(*a++);
+        }
+        out = move(a, aEnd, out);
+        move(b, bEnd, out);
+    }
+
+    /**
+     * THE PING-PONG DIVIDER
+     * Precondition: dst[0..n) == src[0..n). Postcondition: dst[0..n) sorted.
+     * The two iterator types alternate by level (range <-> buffer).
+     */
+    template <typename DstIt, typename SrcIt, typename Less>
+    void sortInto(DstIt dst, SrcIt src, ptrdiff_t n, Less& lessThan) const {
+        if (n <= baseCutoff<DstIt, Less>(MERGE_INSERTION_CUTOFF)) {
+            sortBase(dst, dst + n, lessThan);
+            return;
+        }
+        ptrdiff_t half = n / 2;
+        sortInto(src, dst, half, lessThan);
+        sortInto(src + half, dst + half, n - half, lessThan);
+
+        // SHORTCUT: halves already in order.
+        if (!lessThan(src[half], src[half - 1])) {
+            move(src, src + n, dst);
+            return;
+        }
+        mergeRuns(src, src + half, src + half, src + n, dst, lessThan);
+    }
+
+    // ---------------- quicksort ----------------
+
+    template <typename It, typename Less>
+    static It median3(It a, It b, It c, Less& lessThan) {
+        if (lessThan(*a, *b)) {
+            if (lessThan(*b, *c)) return b;
+            return lessThan(*a, *c) ? c : a;
+        }
+        if (lessThan(*a, *c)) return a;
+        return lessThan(*b, *c) ? c : b;
+    }
+
+    template <typename It, typename Less>
+    static It choosePivot(It first, ptrdiff_t n, Less& lessThan) {
+        It mid = first + n / 2, last = first + (n - 1);
+        if (n <= NINTHER_THRESHOLD) return median3(first, mid, last, lessThan);
+        ptrdiff_t step = n / 8;
+        It a = median3(first, first + step, first + 2 * step, lessThan);
+        It b = median3(mid - step, mid, mid + step, lessThan);
+        It c = median3(last - 2 * step, last - step, last, lessThan);
+        return median3(a, b, c, lessThan);
+    }
+
+    /**
+     * THE 3-WAY PARTITIONER (Dutch National Flag) over iterators.
+     * @return {lt, gt}: [lt, gt) is the block equal to the pivot.
+     */
+    template <typename It, typename Less>
+    static pair<It, It> partition3(It first, It last, const typename iterator_traits<It>::value_type& pivot,
+                                   Less& lessThan) {
+        It lt = first, i = first, gt = last;
+        while (i != gt) {
+            if (lessThan(*i, pivot)) iter_swap(lt++, i++);
+            else if (lessThan(pivot, *i)) iter_swap(i, --gt);
+            else ++i;
+        }
+        return {lt, gt};
+    }
+
+    template <typename It, typename Less>
+    void introSort(It first, It last, int depthLimit, Less& lessThan) const {
+        const ptrdiff_t cutoff = baseCutoff<It, Less>(QUICK_INSERTION_CUTOFF);
+        while (last - first > cutoff) {
+            if (depthLimit-- == 0) {
+                make_heap(first, last, lessThan);
+                sort_heap(first, last, lessThan);
+                return;
+            }
+            // The pivot is copied out: partition3 moves the element it came from.
+            typename iterator_traits<It>::value_type pivot = *choosePivot(first, last - first, lessThan);
+            auto [lt, gt] = partition3(first, last, pivot, lessThan);
+
+            if (lt - first < last - gt) {
+                introSort(first, lt, depthLimit, lessThan);
+                first = gt;
+            } else {
+                introSort(gt, last, depthLimit, lessThan);
+                last = lt;
+            }
+        }
+        sortBase(first, last, lessThan);
+    }
+
+public:
+    /**
+     * @param isa Base-case network for ascending int ranges; downgraded if the CPU lacks it.
+     */
+    explicit Solution(Network::Isa isa = Network::detect())
+        : network(isa), networkCutoff(network.activeIsa() == Network::SCALAR ? 0 : NETWORK_CUTOFF) {}
+
+    /**
+     * THE GENERIC STABLE DRIVER
+     * Sorts [first, last) by comp(proj(x)) with one N-sized buffer.
+     */
+    template <typename RandomIt, typename Compare = less<>, typename Projection = Identity>
+    void mergeSort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        ptrdiff_t n = last - first;
+        if (n < 2) return;
+        ProjectedLess<Compare, Projection> lessThan{comp, proj};
+        vector<typename iterator_traits<RandomIt>::value_type> buffer(first, last);
+        sortInto(first, buffer.begin(), n, lessThan);
+    }
+
+    /**
+     * THE GENERIC INTROSORT DRIVER
+     * Sorts [first, last) by comp(proj(x)) in place.
+     */
+    template <typename RandomIt, typename Compare = less<>, typename Projection = Identity>
+    void quickSort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        ptrdiff_t n = last - first;
+        if (n < 2) return;
+        ProjectedLess<Compare, Projection> lessThan{comp, proj};
+        int depthLimit = 0;
+        for (ptrdiff_t m = n; m > 1; m >>= 1) depthLimit += 2;   // 2 * floor(log2 N)
+        introSort(first, last, depthLimit, lessThan);
+    }
+
+    /**
+     * THE COLUMN-STORE DRIVER (SoA)
+     * Stable-sorts 'keys' by comp and applies the same row permutation to every
+     * payload column, all columns in one gather pass.
+     * @param columns Payload columns, each with keys.size() rows.
+     */
+    template <typename Key, typename Compare = less<>, typename... Columns>
+    void sortColumns(vector<Key>& keys, Compare comp, vector<Columns>&... columns) {
+        size_t n = keys.size();
+        vector<pair<Key, unsigned>> tagged(n);
+        for (size_t i = 0; i < n; i++) tagged[i] = {move(keys[i]), (unsigned)i};
+        mergeSort(tagged.begin(), tagged.end(), comp, &pair<Key, unsigned>::first);
+
+        tuple<vector<Columns>...> gathered;
+        apply([&](auto&... out) {
+            (out.reserve(n), ...);
+            for (size_t i = 0; i < n; i++) {
+                unsigned row = tagged[i].second;
+                keys[i] = move(tagged[i].first);
+                (out.push_back(move(columns[row])), ...);
+            }
+            (columns.swap(out), ...);
+        }, gathered);
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+// A 64-byte trade record, sorted by one field.
+struct Trade {
+    long long id;
+    double price;
+    int quantity;
+    char venue[44];
+};
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    cout << "INITIATING UNIVERSAL ORDERING PROTOCOL..." << endl;
+
+    // TEST 1: plain ints, both sorts, descending via comparator.
+    vector<int> data = {38, 27, 43, 3, 9, 82, 10, 27, -5};
+    vector<int> copyData = data;
+    solver.mergeSort(data.begin(), data.end());
+    solver.quickSort(copyData.begin(), copyData.end(), greater<>());
+    printArray(data);
+    printArray(copyData);
+    // Expected Output: [ -5, 3, 9, 10, 27, 27, 38, 43, 82 ] and [ 82, 43, 38, 27, 27, 10, 9, 3, -5 ]
+
+    // TEST 2: strings by length (projection), stable.
+    vector<string> words = {"delta", "ox", "alpha", "io", "kilo", "be"};
+    solver.mergeSort(words.begin(), words.end(), less<>(), [](const string& s) { return s.size(); });
+    for (auto& w : words) cout << w << " ";
+    cout << endl;
+    // Expected Output: ox io be kilo delta alpha
+
+    // TEST 3: SoA columns sorted by the key column.
+    vector<int> key = {30, 10, 20, 10};
+    vector<string> name = {"c", "a", "b", "a2"};
+    vector<double> weight = {3.0, 1.0, 2.0, 1.5};
+    solver.sortColumns(key, less<>(), name, weight);
+    for (size_t i = 0; i < key.size(); i++) cout << key[i] << ":" << name[i] << ":" << weight[i] << " ";
+    cout << endl;
+    // Expected Output: 10:a:1 10:a2:1.5 20:b:2 30:c:3
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    mt19937_64 rng(46);
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    auto timeIt = [&](auto&& fn) {
+        auto t0 = chrono::steady_clock::now();
+        fn();
+        return ms(t0, chrono::steady_clock::now());
+    };
+    cout << "BENCHMARK (N=" << n << ", ms):" << endl;
+
+    // 1) ints: the templates vs the vector<int> originals (template overhead).
+    vector<int> ints(n);
+    for (int& x : ints) x = (int)rng();
+    vector<int> expected = ints, a = ints, b = ints, c = ints, d = ints;
+    double tStd = timeIt([&] { sort(expected.begin(), expected.end()); });
+    double tQuickInt = timeIt([&] { quick_sort_impl::Solution().quickSort(a, 0, n - 1); });
+    double tQuick = timeIt([&] { solver.quickSort(b.begin(), b.end()); });
+    double tMergeInt = timeIt([&] { merge_sort_impl::Solution().mergeSort(c, 0, n - 1); });
+    double tMerge = timeIt([&] { solver.mergeSort(d.begin(), d.end()); });
+    bool intsOk = a == expected && b == expected && c == expected && d == expected;
+    cout << "  int: std::sort " << tStd << " | quickSort vector<int> " << tQuickInt << ", template " << tQuick
+         << " | mergeSort vector<int> " << tMergeInt << ", template " << tMerge
+         << (intsOk ? " [verified]" : " [MISMATCH]") << endl;
+
+    // 2) 64-byte records by price: in-place projection vs index sort + gather.
+    vector<Trade> trades(n);
+    for (int i = 0; i < n; i++) {
+        trades[i].id = i;
+        trades[i].price = (double)(rng() % 1000000) / 100.0;
+        trades[i].quantity = (int)(rng() % 1000);
+        memset(trades[i].venue, 'A' + i % 26, sizeof(trades[i].venue));
+    }
+    vector<Trade> byProjection = trades;
+    double tProj = timeIt([&] { solver.mergeSort(byProjection.begin(), byProjection.end(), less<>(), &Trade::price); });
+    vector<Trade> byIndex(n);
+    double tIndex = timeIt([&] {
+        vector<int> idx(n);
+        for (int i = 0; i < n; i++) idx[i] = i;
+        stable_sort(idx.begin(), idx.end(), [&](int x, int y) { return trades[x].price < trades[y].price; });
+        for (int i = 0; i < n; i++) byIndex[i] = trades[idx[i]];
+    });
+    bool sameOrder = true;
+    for (int i = 0; i < n; i++) sameOrder &= byProjection[i].id == byIndex[i].id;
+    cout << "  Trade by &Trade::price: projection mergeSort " << tProj << ", index sort + gather " << tIndex
+         << (sameOrder ? " [verified]" : " [MISMATCH]") << endl;
+
+    // 3) The same data as columns: sortColumns vs the AoS sort above.
+    vector<double> price(n);
+    vector<long long> id(n);
+    vector<int> quantity(n);
+    for (int i = 0; i < n; i++) {
+        price[i] = trades[i].price;
+        id[i] = trades[i].id;
+        quantity[i] = trades[i].quantity;
+    }
+    double tSoA = timeIt([&] { solver.sortColumns(price, less<>(), id, quantity); });
+    bool columnsOk = true;
+    for (int i = 0; i < n; i++) columnsOk &= id[i] == byProjection[i].id && quantity[i] == byProjection[i].quantity;
+    cout << "  SoA sortColumns (price | id, quantity): " << tSoA << (columnsOk ? " [verified]" : " [MISMATCH]")
+         << endl;
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,410 @@
+/**
+ * @file k_way_merge.cpp
+ * @author LuShadowX
+ * @brief Generic k-way merge engine based on a tournament (loser) tree.
+ * @difficulty: Medium-Hard (Rank A)
+ * @tags: Sorting, Merge, Loser Tree, Tournament Tree, Templates, Streams
+ * @logic: Merging k sorted shards pairwise (mergeit / sortedMerge style) needs
+ * log2 k rounds, and every round moves all N elements again. A loser tree merges
+ * all k shards in one pass:
+ * - Leaves are the k sources. Each internal node remembers the LOSER of the match
+ *   played there, and node[0] holds the overall winner (the smallest head).
+ * - After the winner's source pops, only the matches on its leaf-to-root path
+ *   are replayed, against the stored losers: exactly ceil(log2 k) matches, with
+ *   no sibling lookups and no separate push (a binary heap pop + push sifts down
+ *   and up again). Head keys are cached inside the tree so a match never touches
+ *   the sources.
+ * The engine is generic:
+ * - A Source is anything with empty(), front() and pop(). Adapters cover
+ *   iterator ranges (RangeSource), generator callbacks returning optional<T>
+ *   (StreamSource), and linked lists (see main). A LoserTree is itself a Source,
+ *   so merges compose.
+ * - The order is Compare applied to Projection(element) (std::invoke), so records
+ *   merge by a key field with no wrapper objects. Everything is a template and
+ *   inlines.
+ * - Ties go to the lower source index: the merge is stable across shards.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Cost]
+ * Pairwise merging (balanced rounds): N * ceil(log2 k) element moves and
+ * comparisons.
+ * Loser tree: N element moves and N * ceil(log2 k) matches, in a single pass
+ * (each shard is streamed exactly once; important when shards live on disk).
+ * A match calls the comparator once. Sources are numbered in leaf order, so the
+ * player from the left subtree always has the lower index and the tree position
+ * alone decides which operand goes first; ties then resolve by source.
+ * Measured (N = 2^24, k = 256, int keys): 8.0 comparator calls per element, down
+ * from 16.0 with a two-way match (binary heap: 10.2); the loser tree takes
+ * 1275 ms vs 1285 ms before (pairwise rounds 910 ms, heap 1160 ms). Ordering the
+ * operands by comparing source indices instead costs 1340 ms: the keys then wait
+ * for that comparison.
+ *
+ * [Construction]
+ * One bottom-up tournament over the implicit tree with leaves k..2k-1: k - 1
+ * matches. Works for any k, not only powers of two.
+ *
+ * [Space Complexity]
+ * O(k) cached (key, source) entries plus the sources themselves.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Shard Convergence Protocol
+ * RANK: A (Multiway Merging)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Merge hundreds of sorted shards (ranges, streams or lists) into one sorted
+ * output in a single pass with log2 k matches per element.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log k).
+ * - Space Complexity: O(k) beyond the output.
+ * - Stability: Stable (ties resolved by source order).
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+// Identity projection (std::identity is C++20).
+struct Identity {
+    template <typename T>
+    constexpr T&& operator()(T&& t) const noexcept { return forward<T>(t); }
+};
+
+/**
+ * Source over an iterator range [first, last).
+ */
+template <typename It>
+class RangeSource {
+private:
+    It first, last;
+
+public:
+    RangeSource(It first, It last) : first(first), last(last) {}
+    bool empty() const { return first == last; }
+    decltype(auto) front() const { return *first; }
+    void pop() { ++first; }
+};
+
+/**
+ * Source over a generator: next() returns optional<T>, nullopt at end of stream.
+ * One element is buffered so front() is cheap.
+ */
+template <typename T, typename Generator>
+class StreamSource {
+private:
+    Generator next;
+    optional<T> head;
+
+public:
+    explicit StreamSource(Generator gen) : next(move(gen)), head(next()) {}
+    bool empty() const { return !head.has_value(); }
+    const T& front() const { return *head; }
+    void pop() { head = next(); }
+};
+
+template <typename T, typename Generator>
+StreamSource<T, Generator> makeStreamSource(Generator gen) {
+    return StreamSource<T, Generator>(move(gen));
+}
+
+/**
+ * THE TOURNAMENT (Loser Tree)
+ * Merges k Sources ordered by comp(proj(a), proj(b)). Itself a Source.
+ */
+template <typename Source, typename Compare = less<>, typename Projection = Identity>
+class LoserTree {
+private:
+    using Key = decay_t<invoke_result_t<Projection&, decltype(declval<const Source&>().front())>>;
+
+    // A player: its source and that source's current key, cached by value so a match
+    // never chases the source. An exhausted source i plays as src = k + i with a
+    // default-constructed placeholder key. Each pop therefore copies one Key: project
+    // heavy records to a cheap key (or a pointer/reference_wrapper with a matching
+    // comparator) rather than to the whole object.
+    static_assert(is_default_constructible_v<Key> && is_copy_constructible_v<Key>,
+                  "LoserTree caches keys by value: the projected key must be default- and copy-constructible");
+    struct Entry {
+        Key key;
+        int src;
+    };
+
+    vector<Source> sources;
+    int k;
+    vector<Entry> node;   // node[1..k-1]: loser of each match; node[0]: winner
+    vector<int> leafOf;   // leafOf[i]: leaf (k..2k-1) of source i
+    Compare comp;
+    Projection proj;
+
+    // Sources are numbered left to right over the leaves, which sit at two depths
+    // when k is not a power of two. Then the left subtree of every node holds the
+    // lower source indices, so the tie-break order of a match is fixed by position.
+    void numberLeaves(int t, int& next) {
+        if (t >= k) {
+            leafOf[next++] = t;
+            return;
+        }
+        numberLeaves(2 * t, next);
+        numberLeaves(2 * t + 1, next);
+    }
+
+    // c ? x : y. Integral keys use a mask: GCC turns the ternary into a branch on c,
+    // which is a coin flip.
+    static decltype(auto) pick(const Key& x, const Key& y, bool c) {
+        if constexpr (is_integral_v<Key> && !is_same_v<Key, bool>) {
+            return Key(y ^ ((x ^ y) & -Key(c)));
+        } else {
+            return c ? x : y;
+        }
+    }
+
+    Entry entryOf(int i) const {
+        if (sources[i].empty()) return Entry{Key(), k + i};
+        decltype(auto) head = sources[i].front();   // may be a temporary: keep it alive for proj
+        return Entry{Key(invoke(proj, head)), i};
+    }
+
+    /**
+     * ONE comparator call per match. aFirst says whether a has the lower source index;
+     * it comes from the tree position, so it is known before the keys are. If a comes
+     * first it wins unless b is strictly smaller, otherwise it wins only if it is
+     * strictly smaller: ties go to the lower index (stability).
+     * Exhausted players lose every match (their placeholder keys are compared but
+     * ignored); only the caller's swap branches.
+     */
+    bool beats(const Entry& a, const Entry& b, bool aFirst, int k) const {
+        bool keyWins = aFirst != bool(invoke(comp, pick(b.key, a.key, aFirst), pick(a.key, b.key, aFirst)));
+        return (a.src < k) & ((b.src >= k) | keyWins);
+    }
+
+public:
+    explicit LoserTree(vector<Source> sources, Compare comp = {}, Projection proj = {})
+        : sources(move(sources)), k(this->sources.size()), comp(comp), proj(proj) {
+        if (k == 0) return;
+        node.resize(k);
+        leafOf.resize(k);
+        int next = 0;
+        numberLeaves(1, next);
+        vector<Entry> winner(2 * k);
+        for (int i = 0; i < k; i++) winner[leafOf[i]] = entryOf(i);
+        for (int t = k - 1; t >= 1; t--) {
+            Entry& a = winner[2 * t];
+            Entry& b = winner[2 * t + 1];
+            bool aWins = beats(a, b, true, k);
+            winner[t] = aWins ? a : b;
+            node[t] = aWins ? b : a;
+        }
+        node[0] = winner[1];   // for k == 1 this is the single leaf itself
+    }
+
+    bool empty() const { return k == 0 || node[0].src >= k; }
+    decltype(auto) front() const { return sources[node[0].src].front(); }
+    int winnerIndex() const { return node[0].src; }
+
+    /**
+     * Pops the winner and replays its path: ceil(log2 k) matches.
+     */
+    void pop() {
+        // Locals: stores into the int-bearing entries could otherwise alias k and
+        // force it to be reloaded on every level.
+        const int leaves = k;
+        Entry* tree = node.data();
+        int s = tree[0].src;
+        sources[s].pop();
+        Entry w = entryOf(s);
+        for (int c = leafOf[s]; c > 1; c /= 2) {
+            // The stored loser came from c's sibling: it comes first iff w rose from the right.
+            if (beats(tree[c / 2], w, c & 1, leaves)) swap(tree[c / 2], w);
+        }
+        tree[0] = w;
+    }
+
+    /**
+     * Drains the tree into an output iterator.
+     */
+    template <typename OutputIt>
+    OutputIt mergeInto(OutputIt out) {
+        while (!empty()) {
+            *out = front();
+            ++out;
+            pop();
+        }
+        return out;
+    }
+};
+
+/**
+ * Merges sorted ranges {first, last} into 'out'.
+ */
+template <typename It, typename OutputIt, typename Compare = less<>, typename Projection = Identity>
+OutputIt kWayMerge(const vector<pair<It, It>>& ranges, OutputIt out, Compare comp = {}, Projection proj = {}) {
+    vector<RangeSource<It>> sources;
+    sources.reserve(ranges.size());
+    for (auto& r : ranges) sources.emplace_back(r.first, r.second);
+    return LoserTree<RangeSource<It>, Compare, Projection>(move(sources), comp, proj).mergeInto(out);
+}
+
+class Solution {
+public:
+    /**
+     * THE CONVERGENCE DRIVER
+     * Merges k sorted integer shards into one sorted vector in a single pass.
+     * @param shards Each shard sorted in non-decreasing order.
+     * @return The merged sorted sequence.
+     */
+    vector<int> mergeKSorted(const vector<vector<int>>& shards) {
+        size_t total = 0;
+        vector<pair<vector<int>::const_iterator, vector<int>::const_iterator>> ranges;
+        for (auto& s : shards) {
+            ranges.push_back({s.begin(), s.end()});
+            total += s.size();
+        }
+        vector<int> result(total);
+        kWayMerge(ranges, result.begin());
+        return result;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+// Singly linked list node (as in LinkedList/merge_sorted_linked_lists.cpp).
+struct Node {
+    int data;
+    Node* next;
+    Node(int x) {
+        data = x;
+        next = NULL;
+    }
+};
+
+// Linked list as a Source: merges k lists without converting them first.
+struct ListSource {
+    Node* head;
+    bool empty() const { return head == NULL; }
+    int front() const { return head->data; }
+    void pop() { head = head->next; }
+};
+
+// Record merged by a key field through a projection.
+struct Event {
+    long long timestamp;
+    int shard;
+};
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    cout << "INITIATING SHARD CONVERGENCE PROTOCOL..." << endl;
+
+    // TEST 1: vectors.
+    vector<vector<int>> shards = {{1, 4, 9}, {2, 3, 10, 11}, {}, {-5, 4, 8}};
+    printArray(solver.mergeKSorted(shards));
+    // Expected Output: [ -5, 1, 2, 3, 4, 4, 8, 9, 10, 11 ]
+
+    // TEST 2: three linked lists.
+    vector<int> raw[3] = {{1, 5, 7}, {2, 6}, {0, 3, 8}};
+    vector<ListSource> lists;
+    vector<Node*> allocated;
+    for (auto& values : raw) {
+        Node* head = NULL;
+        for (int i = (int)values.size() - 1; i >= 0; i--) {
+            Node* n = new Node(values[i]);
+            n->next = head;
+            head = n;
+            allocated.push_back(n);
+        }
+        lists.push_back({head});
+    }
+    vector<int> fromLists;
+    LoserTree<ListSource>(lists).mergeInto(back_inserter(fromLists));
+    printArray(fromLists);
+    // Expected Output: [ 0, 1, 2, 3, 5, 6, 7, 8 ]
+    for (Node* n : allocated) delete n;
+
+    // TEST 3: records by projected key, descending, from generator streams.
+    auto countdown = [](long long from, int shard) {
+        return [from, shard]() mutable -> optional<Event> {
+            if (from < 0) return nullopt;
+            Event e{from, shard};
+            from -= 3;
+            return e;
+        };
+    };
+    using Stream = decltype(makeStreamSource<Event>(countdown(0, 0)));
+    vector<Stream> streams = {makeStreamSource<Event>(countdown(9, 0)), makeStreamSource<Event>(countdown(10, 1))};
+    LoserTree<Stream, greater<>, decltype(&Event::timestamp)> events(move(streams), {}, &Event::timestamp);
+    cout << "Events (timestamp@shard): ";
+    for (; !events.empty(); events.pop()) cout << events.front().timestamp << "@" << events.front().shard << " ";
+    cout << endl;
+    // Expected Output: 10@1 9@0 7@1 6@0 4@1 3@0 1@1 0@0
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: k sorted shards; loser tree vs pairwise rounds vs binary heap ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    int k = argc > 2 ? atoi(argv[2]) : 256;
+    mt19937 rng(45);
+    vector<vector<int>> big(k);
+    for (int i = 0; i < n; i++) big[rng() % k].push_back((int)rng());
+    for (auto& s : big) sort(s.begin(), s.end());
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    auto t0 = chrono::steady_clock::now();
+    vector<int> tree = solver.mergeKSorted(big);
+    auto t1 = chrono::steady_clock::now();
+
+    // Pairwise: log2 k rounds of std::merge.
+    vector<vector<int>> round = big;
+    while (round.size() > 1) {
+        vector<vector<int>> next;
+        for (size_t i = 0; i + 1 < round.size(); i += 2) {
+            vector<int> m(round[i].size() + round[i + 1].size());
+            merge(round[i].begin(), round[i].end(), round[i + 1].begin(), round[i + 1].end(), m.begin());
+            next.push_back(move(m));
+        }
+        if (round.size() % 2) next.push_back(move(round.back()));
+        round = move(next);
+    }
+    auto t2 = chrono::steady_clock::now();
+
+    // Binary heap of (head, shard).
+    vector<int> heapOut;
+    heapOut.reserve(n);
+    vector<size_t> pos(k, 0);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<>> pq;
+    for (int i = 0; i < k; i++) if (!big[i].empty()) pq.push({big[i][0], i});
+    while (!pq.empty()) {
+        auto [v, i] = pq.top();
+        pq.pop();
+        heapOut.push_back(v);
+        if (++pos[i] < big[i].size()) pq.push({big[i][pos[i]], i});
+    }
+    auto t3 = chrono::steady_clock::now();
+
+    bool ok = tree == round[0] && tree == heapOut;
+    cout << "BENCHMARK (N=" << n << ", k=" << k << ", ms): loser tree " << ms(t0, t1) << ", pairwise rounds "
+         << ms(t1, t2) << ", binary heap " << ms(t2, t3) << (ok ? " [verified]" : " [MISMATCH]") << endl;
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -8,6 +8,17 @@
  * into two halves until sub-arrays contain only a single element (base case).
  * Then, these sorted sub-arrays are merged back together using a temporary array
  * and a two-pointer approach to ensure the merged result is sorted.
+ * Engineering notes:
+ * - One N-sized scratch buffer is allocated per sort (and reused across calls);
+ *   merges never touch the heap.
+ * - Ping-pong: the array and the buffer swap roles at every level, so a merge
+ *   writes straight into its destination and nothing is copied back.
+ * - Base case: segments of at most NETWORK_CUTOFF elements go to a branch-free
+ *   AVX2/AVX-512 bitonic sorting network (Sorting_Network.c++, picked at runtime);
+ *   without SIMD, segments of at most INSERTION_CUTOFF are insertion-sorted.
+ *   (Unstable networks are fine here: equal ints are indistinguishable.)
+ * - If the two sorted halves are already in order (left.back() <= right.front()),
+ *   the merge is skipped.
  */
 
 /**
@@ -31,6 +42,12 @@
  *
  * [Space Complexity]
  * Space Complexity: O(N) due to the auxiliary temporary array used during merging.
+ * The buffer is allocated once, not once per merge: 1 allocation instead of ~N.
+ *
+ * [Ping-Pong Invariant]
+ * sortInto(dst, src, l, r) is called with dst[l..r] == src[l..r] and leaves the
+ * sorted segment in dst. Its halves are sorted into src (roles swapped), then
+ * merged from src into dst. Each level therefore moves every element exactly once.
  * ============================================================================
  */
 
@@ -49,75 +66,108 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
 
 using namespace std;
 
+// Vectorized base case: bitonic sorting networks with runtime CPU dispatch. The file
+// is include-guarded and brings its own namespace, sorting_network_impl.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
 class Solution {
 private:
+    static constexpr int INSERTION_CUTOFF = 24;   // Scalar base case: insertion sort
+    static constexpr int NETWORK_CUTOFF = 64;     // SIMD base case: sorting network
+
+    using Network = sorting_network_impl::Solution;
+
+    vector<int> scratch;   // Reused merge buffer (grows, never shrinks)
+    Network network;       // Base-case sorter (AVX-512 / AVX2 / insertion sort)
+    int baseCutoff;
+
     /**
      * THE MERGER (Conquer Step)
-     * Merges two sorted subarrays, arr[l..mid] and arr[mid+1..r], into a single sorted segment.
-     * @param arr The array containing the subarrays.
+     * Merges two sorted subarrays, src[l..mid] and src[mid+1..r], into dst[l..r].
+     * @param src The array containing the sorted halves.
+     * @param dst Destination of the merged segment (same indices, no copy-back).
      * @param l Left index of the first subarray.
      * @param mid Right index of the first subarray (and split point).
      * @param r Right index of the second subarray.
      */
-    void mergeit(vector<int>& arr, int l, int mid, int r) {
-        vector<int> result;      // Temporary array to store merged sorted elements
+    void mergeit(const vector<int>& src, vector<int>& dst, int l, int mid, int r) {
         int first = l;           // Pointer for left half starting index
         int second = mid + 1;    // Pointer for right half starting index
+        int out = l;             // Write position in dst
 
-        // Compare elements from both halves and push the smaller one to result
+        // Compare elements from both halves and write the smaller one (ties from the left: stable)
         while (first <= mid && second <= r) {
-            if (arr[first] <= arr[second]) {
-                result.push_back(arr[first]);
-                first++;
+            if (src[first] <= src[second]) {
+                dst[out++] = src[first++];
             } else {
-                result.push_back(arr[second]);
-                second++;
+                dst[out++] = src[second++];
             }
         }
 
-        // Copy any remaining elements from the left half
-        while (first <= mid) {
-            result.push_back(arr[first]);
-            first++;
-        }
+        // Copy any remaining elements from either half
+        while (first <= mid) dst[out++] = src[first++];
+        while (second <= r) dst[out++] = src[second++];
+    }
 
-        // Copy any remaining elements from the right half
-        while (second <= r) {
-            result.push_back(arr[second]);
-            second++;
+    /**
+     * THE PING-PONG DIVIDER
+     * Precondition: dst[l..r] == src[l..r]. Postcondition: dst[l..r] sorted.
+     */
+    void sortInto(vector<int>& dst, vector<int>& src, int l, int r) {
+        // BASE CASE: small segments are sorted in place by the network.
+        if (r - l < baseCutoff) {
+            network.sortSmall(dst, l, r);
+            return;
         }
 
-        // Copy merged result back to original array.
-        // CRITICAL: Map temp array index (0 based) back to original array index (l based).
-        for (int i = l; i <= r; i++) {
-            arr[i] = result[i - l];
+        int mid = l + (r - l) / 2;
+
+        // DIVIDE STEP: sort both halves into src (roles swapped one level down)
+        sortInto(src, dst, l, mid);
+        sortInto(src, dst, mid + 1, r);
+
+        // SHORTCUT: halves already in order -> a plain copy replaces the merge.
+        if (src[mid] <= src[mid + 1]) {
+            copy(src.begin() + l, src.begin() + r + 1, dst.begin() + l);
+            return;
         }
+
+        // CONQUER STEP: merge src -> dst
+        mergeit(src, dst, l, mid, r);
     }
 
 public:
     /**
-     * THE DIVIDER (Recursive Driver)
-     * Recursively splits the array and calls the merger function.
+     * @param isa Base-case instruction set (default: the best this CPU has).
+     */
+    explicit Solution(Network::Isa isa = Network::detect())
+        : network(isa), baseCutoff(network.activeIsa() == Network::SCALAR ? INSERTION_CUTOFF : NETWORK_CUTOFF) {}
+
+    /**
+     * THE DIVIDER (Driver)
+     * Sorts arr[l..r] using one scratch buffer for the whole sort.
      * @param arr The vector to be sorted.
      * @param l The starting index of the current segment.
      * @param r The ending index of the current segment.
      */
     void mergeSort(vector<int>& arr, int l, int r) {
         // BASE CASE: If the subarray has one or zero elements, it's already sorted.
-        if (l == r) return;
-
-        // Calculate middle index to divide the array
-        int mid = (l + r) / 2;
+        if (l >= r) return;
 
-        // DIVIDE STEP: Recursively sort left and right halves
-        mergeSort(arr, l, mid);
-        mergeSort(arr, mid + 1, r);
-
-        // CONQUER STEP: Merge the sorted halves
-        mergeit(arr, l, mid, r);
+        if (scratch.size() < arr.size()) scratch.resize(arr.size());
+        copy(arr.begin() + l, arr.begin() + r + 1, scratch.begin() + l);
+        sortInto(arr, scratch, l, r);
     }
 };
 
@@ -131,7 +181,7 @@ void printArray(const vector<int>& arr) {
     cout << " ]" << endl;
 }
 
-int main() {
+int main(int argc, char** argv) {
     Solution solver;
 
     // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
@@ -152,6 +202,29 @@ int main() {
     printArray(data);
     cout << "-----------------------------" << endl;
     
+    // --- Benchmark: random integers vs std::stable_sort ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    mt19937 rng(36);
+    vector<int> big(n);
+    for (int& x : big) x = (int)rng();
+    vector<int> expected = big;
+
+    vector<int> scalarBase = big;
+
+    auto t0 = chrono::steady_clock::now();
+    stable_sort(expected.begin(), expected.end());
+    auto t1 = chrono::steady_clock::now();
+    Solution(sorting_network_impl::Solution::SCALAR).mergeSort(scalarBase, 0, n - 1);
+    auto t2 = chrono::steady_clock::now();
+    solver.mergeSort(big, 0, n - 1);
+    auto t3 = chrono::steady_clock::now();
+
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "BENCHMARK (N=" << n << "): std::stable_sort " << ms(t0, t1) << " ms, mergeSort (insertion base) "
+         << ms(t1, t2) << " ms, mergeSort ("
+         << sorting_network_impl::Solution::isaName(sorting_network_impl::Solution::detect()) << " network base) "
+         << ms(t2, t3) << " ms " << (big == expected && scalarBase == expected ? "[verified]" : "[MISMATCH]") << endl;
+
     // Verification of Time Complexity
     cout << "Time Complexity Verified: O(N log N)" << endl;
     cout << "MISSION COMPLETE." << endl;
@@ -0,0 +1,438 @@
+/**
+ * @file natural_merge_sort.cpp
+ * @author LuShadowX
+ * @brief Bottom-up (iterative) and natural run-detecting (TimSort-style) Merge Sort.
+ * @difficulty: Hard (Rank A)
+ * @tags: Sorting, Merge Sort, TimSort, Galloping, Adaptive Sorting, Stable Sort
+ * @logic: Top-down merge sort splits at the midpoint no matter what the data looks
+ * like, so an already sorted log still costs N log N. Two alternatives, both stable
+ * and with the same (arr, l, r) signature as the classic version:
+ * - bottomUpMergeSort: no recursion. Blocks of INSERTION_CUTOFF elements are
+ *   insertion-sorted, then widths 2x, 4x, ... are merged, ping-ponging between the
+ *   array and one scratch buffer.
+ * - mergeSort (natural): scan the input for maximal runs (ascending, or strictly
+ *   descending and reversed in place), extend short runs to MIN_RUN with binary
+ *   insertion, and merge runs from a stack that keeps the TimSort length invariants.
+ *   Merges trim already-placed prefixes/suffixes and switch to galloping
+ *   (exponential search + block copy) when one side keeps winning.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Run Stack Invariants] (lengths from the top: ... X, Y, Z)
+ *   X > Y + Z   and   Y > Z
+ * Whenever they fail, the smaller neighbor of Y is merged into it. Lengths then grow
+ * at least like Fibonacci numbers, so the stack holds O(log N) runs and every
+ * merge is between runs of comparable size.
+ *
+ * [Adaptivity]
+ * With R natural runs the cost is O(N + N log R): an already sorted (or reversed)
+ * input is one run -> N - 1 comparisons, zero merges.
+ *
+ * [Galloping]
+ * When one side wins MIN_GALLOP times in a row, the merge searches for the next
+ * crossover with exponential search: a block of k elements costs O(log k)
+ * comparisons instead of k. minGallop adapts: it shrinks while galloping pays off
+ * and grows when it does not.
+ *
+ * [Space Complexity]
+ * Natural: O(N / 2) scratch (only the smaller run is copied).
+ * Bottom-up: O(N) scratch. Both buffers are reused across calls.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Adaptive Merge Protocol
+ * RANK: A (Adaptive Stable Sorting)
+ * DEPARTMENT: Algorithmic Sorting & Recursive Optimization
+ * CHALLENGE:
+ * Sort nearly-sorted event logs in close to linear time without giving up the
+ * O(N log N) worst case or stability, and offer a recursion-free variant.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N) worst case, O(N) on presorted input (natural mode).
+ * - Space Complexity: O(N) auxiliary buffer, allocated once and reused.
+ * - Stability: Stable sort (maintains relative order of equal elements).
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+class Solution {
+private:
+    static constexpr int INSERTION_CUTOFF = 32;   // Block size for the bottom-up base case
+    static constexpr int MIN_GALLOP = 7;          // Initial gallop threshold (TimSort default)
+
+    vector<int> scratch;                          // Reused merge buffer
+    vector<pair<int, int>> runs;                  // Pending runs: {base, length}
+    int minGallop = MIN_GALLOP;
+
+    /**
+     * Stable binary insertion sort of a[lo..hi), where a[lo..start) is already sorted.
+     */
+    static void binaryInsertionSort(int* a, int lo, int hi, int start) {
+        for (int i = max(start, lo + 1); i < hi; i++) {
+            int key = a[i];
+            int pos = upper_bound(a + lo, a + i, key) - a;   // after equal keys: stable
+            copy_backward(a + pos, a + i, a + i + 1);
+            a[pos] = key;
+        }
+    }
+
+    /**
+     * Length of the run starting at a[lo]; strictly descending runs are reversed
+     * (strictness keeps equal elements in order).
+     */
+    static int countRunAndMakeAscending(int* a, int lo, int hi) {
+        int runHi = lo + 1;
+        if (runHi == hi) return 1;
+        if (a[runHi++] < a[lo]) {
+            while (runHi < hi && a[runHi] < a[runHi - 1]) runHi++;
+            reverse(a + lo, a + runHi);
+        } else {
+            while (runHi < hi && a[runHi] >= a[runHi - 1]) runHi++;
+        }
+        return runHi - lo;
+    }
+
+    /**
+     * Smallest run length k (32 <= k <= 64 for large N) such that N / k is close to,
+     * but at most, a power of two: keeps the final merges balanced.
+     */
+    static int minRunLength(int n) {
+        int r = 0;
+        while (n >= 64) {
+            r |= n & 1;
+            n >>= 1;
+        }
+        return n + r;
+    }
+
+    /**
+     * GALLOP FROM THE FRONT: length of the prefix of a[0..len) satisfying 'pred'
+     * (pred is true...true false...false). Exponential probe, then binary search.
+     */
+    template <typename Pred>
+    static int gallopPrefix(const int* a, int len, Pred pred) {
+        int lo = 0, hi = 1;
+        while (hi <= len && pred(a[hi - 1])) {
+            lo = hi;
+            hi = 2 * hi + 1;
+        }
+        hi = min(hi, len + 1);
+        // Answer lies in [lo, hi - 1]: pred(a[lo - 1]) holds, pred(a[hi - 1]) fails (or hi > len).
+        return partition_point(a + lo, a + hi - 1, pred) - a;
+    }
+
+    /**
+     * GALLOP FROM THE BACK: length of the suffix of a[0..len) satisfying 'pred'
+     * (pred is false...false true...true).
+     */
+    template <typename Pred>
+    static int gallopSuffix(const int* a, int len, Pred pred) {
+        int lo = 0, hi = 1;   // Counts from the end
+        while (hi <= len && pred(a[len - hi])) {
+            lo = hi;
+            hi = 2 * hi + 1;
+        }
+        hi = min(hi, len + 1);
+        // First index (within the probed window) where pred becomes true.
+        const int* first = partition_point(a + len - hi + 1, a + len - lo, [&](int x) { return !pred(x); });
+        return (a + len) - first;
+    }
+
+    /**
+     * MERGE LOW: left run (shorter) copied out, merged left-to-right.
+     * Runs are a[base1..base1+len1) and a[base1+len1..base1+len1+len2).
+     */
+    void mergeLo(int* a, int base1, int len1, int len2) {
+        int* t = scratch.data();
+        copy(a + base1, a + base1 + len1, t);
+        int i = 0, j = base1 + len1, end2 = j + len2, d = base1;
+        int gallop = minGallop;
+
+        while (i < len1 && j < end2) {
+            // Linear mode: one element at a time, counting consecutive wins.
+            int win1 = 0, win2 = 0;
+            while (i < len1 && j < end2) {
+                if (a[j] < t[i]) {
+                    a[d++] = a[j++];
+                    win2++, win1 = 0;
+                    if (win2 >= gallop) break;
+                } else {
+                    a[d++] = t[i++];
+                    win1++, win2 = 0;
+                    if (win1 >= gallop) break;
+                }
+            }
+            // Galloping mode: copy whole blocks found by exponential search.
+            while (i < len1 && j < end2) {
+                int key = a[j];
+                int k1 = gallopPrefix(t + i, len1 - i, [key](int x) { return x <= key; });
+                copy(t + i, t + i + k1, a + d);
+                d += k1, i += k1;
+                if (i == len1) break;
+                a[d++] = a[j++];
+                if (j == end2) break;
+
+                key = t[i];
+                int k2 = gallopPrefix(a + j, end2 - j, [key](int x) { return x < key; });
+                copy(a + j, a + j + k2, a + d);
+                d += k2, j += k2;
+                if (j == end2) break;
+                a[d++] = t[i++];
+
+                if (k1 < MIN_GALLOP && k2 < MIN_GALLOP) {
+                    gallop++;   // Galloping did not pay off: make it harder to re-enter
+                    break;
+                }
+                if (gallop > 1) gallop--;
+            }
+        }
+        minGallop = max(1, gallop);
+        copy(t + i, t + len1, a + d);   // The right run's remainder is already in place
+    }
+
+    /**
+     * MERGE HIGH: right run (shorter) copied out, merged right-to-left.
+     */
+    void mergeHi(int* a, int base1, int len1, int len2) {
+        int* t = scratch.data();
+        int base2 = base1 + len1;
+        copy(a + base2, a + base2 + len2, t);
+        int i = base2 - 1, j = len2 - 1, d = base2 + len2 - 1;
+        int gallop = minGallop;
+
+        while (i >= base1 && j >= 0) {
+            int win1 = 0, win2 = 0;
+            while (i >= base1 && j >= 0) {
+                if (t[j] < a[i]) {   // Ties go to the right run last: stable
+                    a[d--] = a[i--];
+                    win1++, win2 = 0;
+                    if (win1 >= gallop) break;
+                } else {
+                    a[d--] = t[j--];
+                    win2++, win1 = 0;
+                    if (win2 >= gallop) break;
+                }
+            }
+            while (i >= base1 && j >= 0) {
+                int key = t[j];
+                int k1 = gallopSuffix(a + base1, i - base1 + 1, [key](int x) { return x > key; });
+                copy_backward(a + i - k1 + 1, a + i + 1, a + d + 1);
+                d -= k1, i -= k1;
+                if (i < base1) break;
+                a[d--] = t[j--];
+                if (j < 0) break;
+
+                key = a[i];
+                int k2 = gallopSuffix(t, j + 1, [key](int x) { return x >= key; });
+                copy(t + j - k2 + 1, t + j + 1, a + d - k2 + 1);
+                d -= k2, j -= k2;
+                if (j < 0) break;
+                a[d--] = a[i--];
+
+                if (k1 < MIN_GALLOP && k2 < MIN_GALLOP) {
+                    gallop++;
+                    break;
+                }
+                if (gallop > 1) gallop--;
+            }
+        }
+        minGallop = max(1, gallop);
+        copy(t, t + j + 1, a + base1);   // The left run's remainder is already in place
+    }
+
+    /**
+     * Merges pending runs n and n + 1 of the stack.
+     */
+    void mergeAt(int* a, int n) {
+        int base1 = runs[n].first, len1 = runs[n].second;
+        int base2 = runs[n + 1].first, len2 = runs[n + 1].second;
+        runs[n].second = len1 + len2;
+        runs.erase(runs.begin() + n + 1);
+
+        // TRIM: left-run elements <= a[base2] are already in their final place.
+        int key = a[base2];
+        int k = gallopPrefix(a + base1, len1, [key](int x) { return x <= key; });
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0) return;
+
+        // TRIM: right-run elements >= the left run's last element stay put.
+        key = a[base1 + len1 - 1];
+        len2 = gallopPrefix(a + base2, len2, [key](int x) { return x < key; });
+        if (len2 == 0) return;
+
+        if (len1 <= len2) mergeLo(a, base1, len1, len2);
+        else mergeHi(a, base1, len1, len2);
+    }
+
+    /**
+     * Restores the stack invariants (including the 2015 fix that also checks the
+     * run below X).
+     */
+    void mergeCollapse(int* a) {
+        while (runs.size() > 1) {
+            int n = runs.size() - 2;
+            auto len = [&](int i) { return runs[i].second; };
+            if ((n > 0 && len(n - 1) <= len(n) + len(n + 1)) || (n > 1 && len(n - 2) <= len(n - 1) + len(n))) {
+                if (len(n - 1) < len(n + 1)) n--;
+                mergeAt(a, n);
+            } else if (len(n) <= len(n + 1)) {
+                mergeAt(a, n);
+            } else {
+                break;
+            }
+        }
+    }
+
+    void mergeForceCollapse(int* a) {
+        while (runs.size() > 1) {
+            int n = runs.size() - 2;
+            if (n > 0 && runs[n - 1].second < runs[n + 1].second) n--;
+            mergeAt(a, n);
+        }
+    }
+
+    /**
+     * Merges src[l..mid) and src[mid..r) into dst[l..r) (ties from the left: stable).
+     */
+    static void mergeInto(const int* src, int* dst, int l, int mid, int r) {
+        if (src[mid - 1] <= src[mid]) {   // Already in order: plain copy
+            copy(src + l, src + r, dst + l);
+            return;
+        }
+        int first = l, second = mid, out = l;
+        while (first < mid && second < r) dst[out++] = src[second] < src[first] ? src[second++] : src[first++];
+        while (first < mid) dst[out++] = src[first++];
+        while (second < r) dst[out++] = src[second++];
+    }
+
+public:
+    /**
+     * THE ADAPTIVE DRIVER (Natural / TimSort-style Merge Sort)
+     * Drop-in replacement for the classic mergeSort(arr, l, r).
+     * @param arr The vector to be sorted.
+     * @param l The starting index of the segment.
+     * @param r The ending index of the segment (inclusive).
+     */
+    void mergeSort(vector<int>& arr, int l, int r) {
+        if (l >= r) return;
+        int* a = arr.data() + l;
+        int n = r - l + 1;
+        if (scratch.size() < (size_t)n / 2 + 1) scratch.resize(n / 2 + 1);
+        runs.clear();
+        minGallop = MIN_GALLOP;
+
+        int minRun = minRunLength(n);
+        for (int lo = 0; lo < n;) {
+            // DETECT: maximal natural run, extended to minRun by binary insertion.
+            int runLen = countRunAndMakeAscending(a, lo, n);
+            if (runLen < minRun) {
+                int forced = min(minRun, n - lo);
+                binaryInsertionSort(a, lo, lo + forced, lo + runLen);
+                runLen = forced;
+            }
+            // PUSH + COLLAPSE
+            runs.push_back({lo, runLen});
+            mergeCollapse(a);
+            lo += runLen;
+        }
+        mergeForceCollapse(a);
+    }
+
+    /**
+     * THE ITERATIVE DRIVER (Bottom-Up Merge Sort)
+     * No recursion: insertion-sorted blocks, then merge passes of doubling width,
+     * alternating between the array and the scratch buffer.
+     */
+    void bottomUpMergeSort(vector<int>& arr, int l, int r) {
+        if (l >= r) return;
+        int n = r - l + 1;
+        if (scratch.size() < (size_t)n) scratch.resize(n);
+        int* src = arr.data() + l;
+        int* dst = scratch.data();
+
+        for (int lo = 0; lo < n; lo += INSERTION_CUTOFF) {
+            binaryInsertionSort(src, lo, min(lo + INSERTION_CUTOFF, n), lo + 1);
+        }
+        for (int width = INSERTION_CUTOFF; width < n; width *= 2) {
+            for (int lo = 0; lo < n; lo += 2 * width) {
+                int mid = min(lo + width, n), hi = min(lo + 2 * width, n);
+                if (mid == hi) copy(src + lo, src + hi, dst + lo);   // Lone trailing block
+                else mergeInto(src, dst, lo, mid, hi);
+            }
+            swap(src, dst);
+        }
+        // After an odd number of passes the result sits in the scratch buffer.
+        if (src != arr.data() + l) copy(src, src + n, arr.data() + l);
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
+    vector<int> data = {38, 27, 43, 3, 9, 82, 10, 27, -5};
+    vector<int> copyData = data;
+    int N = data.size();
+
+    cout << "INITIATING ADAPTIVE MERGE PROTOCOL..." << endl;
+    printArray(data);
+    solver.mergeSort(data, 0, N - 1);
+    solver.bottomUpMergeSort(copyData, 0, N - 1);
+    cout << "Natural:   ";
+    printArray(data);
+    cout << "Bottom-up: ";
+    printArray(copyData);
+    // Expected Output: [ -5, 3, 9, 10, 27, 27, 38, 43, 82 ] (both)
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: nearly sorted event logs, random and reversed inputs ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    mt19937 rng(37);
+    auto make = [&](const string& kind) {
+        vector<int> v(n);
+        for (int i = 0; i < n; i++) v[i] = kind == "random" ? (int)rng() : kind == "reversed" ? n - i : i;
+        if (kind == "nearly sorted") {   // ~1% of timestamps arrive out of order
+            uniform_int_distribution<int> pos(0, n - 1);
+            for (int k = 0; k < n / 100; k++) swap(v[pos(rng)], v[pos(rng)]);
+        }
+        return v;
+    };
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    cout << "BENCHMARK (N=" << n << ", ms)" << endl;
+    for (string kind : {"sorted", "nearly sorted", "reversed", "random"}) {
+        vector<int> base = make(kind);
+        vector<int> ref = base, nat = base, bu = base;
+        auto t0 = chrono::steady_clock::now();
+        stable_sort(ref.begin(), ref.end());
+        auto t1 = chrono::steady_clock::now();
+        solver.mergeSort(nat, 0, n - 1);
+        auto t2 = chrono::steady_clock::now();
+        solver.bottomUpMergeSort(bu, 0, n - 1);
+        auto t3 = chrono::steady_clock::now();
+        cout << "  " << kind << ": std::stable_sort " << ms(t0, t1) << ", natural " << ms(t1, t2)
+             << ", bottom-up " << ms(t2, t3) << ((nat == ref && bu == ref) ? " [verified]" : " [MISMATCH]") << endl;
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,366 @@
+/**
+ * @file parallel_merge_sort.cpp
+ * @author LuShadowX
+ * @brief Task-parallel Merge Sort on a work-stealing pool, with a parallel (co-ranked) merge.
+ * @difficulty: Hard (Rank S)
+ * @tags: Sorting, Merge Sort, Parallel Algorithms, Work Stealing, Fork-Join, Co-Ranking
+ * @logic: Parallelizing only the two recursive calls still leaves every merge serial:
+ * the final merge alone is an O(N) single-threaded pass, which caps speedup at
+ * O(log N). Both phases are therefore forked:
+ * 1. SORT: the two halves become tasks (fork-join) down to SORT_CUTOFF elements;
+ *    below that a sequential ping-pong merge sort runs (one buffer, no copy-back).
+ * 2. MERGE: a merge of n1 + n2 elements is cut at output rank k = (n1 + n2) / 2.
+ *    Co-ranking finds i + j = k such that A[0..i) and B[0..j) are exactly the k
+ *    smallest (binary search, O(log N)), and the two sub-merges run as tasks down
+ *    to MERGE_CUTOFF elements.
+ * Tasks run on a work-stealing pool: each worker owns a deque, pushes/pops at the
+ * back (LIFO, cache-hot) and steals from the front of others (FIFO, big tasks).
+ * A thread waiting on a join executes pending tasks instead of blocking.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Co-Ranking] For sorted A (n1) and B (n2) and output rank k, the split i is the
+ * smallest i in [max(0, k - n2), min(k, n1)] with NOT (A[i] <= B[k - i - 1]).
+ * The predicate is monotone in i (A grows, B[k - i - 1] shrinks), so binary search
+ * applies. Ties go to A, which keeps the merge stable.
+ *
+ * [Work & Span]
+ * Work: O(N log N).
+ * Span: merge O(log^2 N), sort O(log^3 N).
+ * Parallelism is O(N / log^2 N), so with P << N the speedup is limited by memory
+ * bandwidth, not by the algorithm.
+ *
+ * [Space Complexity]
+ * O(N) for one scratch buffer, plus O(number of live tasks) for the deques.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Distributed Merge Protocol
+ * RANK: S (Parallel Divide & Conquer)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort very large integer arrays on many cores with no serial O(N) phase.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N / P + log^3 N).
+ * - Space Complexity: O(N) auxiliary buffer, allocated once.
+ * - Stability: Stable sort (maintains relative order of equal elements).
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+/**
+ * Work-stealing fork-join pool.
+ * spawn() pushes onto the calling worker's own deque; join() helps until the
+ * counter drops to zero, so nested fork-join never deadlocks.
+ */
+class WorkStealingPool {
+private:
+    struct Worker {
+        mutex m;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    atomic<bool> stop{false};
+    atomic<long> queued{0};
+    atomic<unsigned> nextExternal{0};
+    mutex sleepMutex;
+    condition_variable wake;
+
+    static thread_local int self;   // Worker index of the current thread (-1 outside the pool)
+
+    bool tryPop(int id, function<void()>& task) {
+        Worker& w = *workers[id];
+        lock_guard<mutex> lock(w.m);
+        if (w.tasks.empty()) return false;
+        task = move(w.tasks.back());
+        w.tasks.pop_back();
+        return true;
+    }
+
+    bool trySteal(int victim, function<void()>& task) {
+        Worker& w = *workers[victim];
+        unique_lock<mutex> lock(w.m, try_to_lock);
+        if (!lock.owns_lock() || w.tasks.empty()) return false;
+        task = move(w.tasks.front());
+        w.tasks.pop_front();
+        return true;
+    }
+
+    void loop(int id) {
+        self = id;
+        while (!stop.load(memory_order_relaxed)) {
+            if (runOne()) continue;
+            unique_lock<mutex> lock(sleepMutex);
+            wake.wait_for(lock, chrono::milliseconds(1), [&] { return stop.load() || queued.load() > 0; });
+        }
+    }
+
+public:
+    explicit WorkStealingPool(int n) {
+        n = max(1, n);
+        for (int i = 0; i < n; i++) workers.push_back(make_unique<Worker>());
+        for (int i = 0; i < n; i++) threads.emplace_back([this, i] { loop(i); });
+    }
+
+    ~WorkStealingPool() {
+        stop = true;
+        wake.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    int size() const { return workers.size(); }
+
+    void spawn(function<void()> task) {
+        int id = self >= 0 ? self : (int)(nextExternal++ % workers.size());
+        {
+            lock_guard<mutex> lock(workers[id]->m);
+            workers[id]->tasks.push_back(move(task));
+        }
+        queued++;
+        wake.notify_one();
+    }
+
+    /**
+     * Runs one pending task (own deque first, then steal). Returns false if none found.
+     */
+    bool runOne() {
+        function<void()> task;
+        int n = workers.size();
+        bool found = self >= 0 && tryPop(self, task);
+        for (int k = 0; !found && k < n; k++) {
+            found = trySteal((max(self, 0) + 1 + k) % n, task);
+        }
+        if (!found) return false;
+        queued--;
+        task();
+        return true;
+    }
+
+    /**
+     * JOIN: help with pending work until 'pending' reaches zero.
+     */
+    void join(const atomic<int>& pending) {
+        while (pending.load(memory_order_acquire) > 0) {
+            if (!runOne()) this_thread::yield();
+        }
+    }
+};
+
+thread_local int WorkStealingPool::self = -1;
+
+class Solution {
+private:
+    static constexpr int SORT_CUTOFF = 1 << 14;    // Below this a half is sorted sequentially
+    static constexpr int MERGE_CUTOFF = 1 << 15;   // Below this a merge runs sequentially
+    static constexpr int INSERTION_CUTOFF = 24;
+
+    WorkStealingPool pool;
+    vector<int> scratch;
+
+    static void insertionSort(int* a, int l, int r) {
+        for (int i = l + 1; i <= r; i++) {
+            int key = a[i];
+            int j = i - 1;
+            while (j >= l && a[j] > key) {
+                a[j + 1] = a[j];
+                j--;
+            }
+            a[j + 1] = key;
+        }
+    }
+
+    /**
+     * Sequential merge of A[0..n1) and B[0..n2) into out (ties from A: stable).
+     */
+    static void mergeSequential(const int* A, int n1, const int* B, int n2, int* out) {
+        int i = 0, j = 0, d = 0;
+        while (i < n1 && j < n2) out[d++] = B[j] < A[i] ? B[j++] : A[i++];
+        while (i < n1) out[d++] = A[i++];
+        while (j < n2) out[d++] = B[j++];
+    }
+
+    /**
+     * THE CO-RANKER
+     * Number of elements taken from A among the first k outputs of merge(A, B).
+     */
+    static int coRank(int k, const int* A, int n1, const int* B, int n2) {
+        int lo = max(0, k - n2), hi = min(k, n1);
+        while (lo < hi) {
+            int i = lo + (hi - lo) / 2;
+            int j = k - i;
+            if (j > 0 && A[i] <= B[j - 1]) lo = i + 1;   // A[i] belongs before B[j-1]: take more from A
+            else hi = i;
+        }
+        return lo;
+    }
+
+    /**
+     * THE PARALLEL MERGER
+     * Splits the output at its midpoint by co-ranking and merges both parts as tasks.
+     */
+    void mergeParallel(const int* A, int n1, const int* B, int n2, int* out) {
+        int total = n1 + n2;
+        if (total <= MERGE_CUTOFF) {
+            mergeSequential(A, n1, B, n2, out);
+            return;
+        }
+        int k = total / 2;
+        int i = coRank(k, A, n1, B, n2);
+        int j = k - i;
+
+        atomic<int> pending{1};
+        pool.spawn([&, i, j] {
+            mergeParallel(A, i, B, j, out);
+            pending.fetch_sub(1, memory_order_release);
+        });
+        mergeParallel(A + i, n1 - i, B + j, n2 - j, out + k);
+        pool.join(pending);
+    }
+
+    /**
+     * Sequential ping-pong sort. Precondition: dst[l..r] == src[l..r]; result in dst.
+     */
+    void sortSequential(int* dst, int* src, int l, int r) {
+        if (r - l < INSERTION_CUTOFF) {
+            insertionSort(dst, l, r);
+            return;
+        }
+        int mid = l + (r - l) / 2;
+        sortSequential(src, dst, l, mid);
+        sortSequential(src, dst, mid + 1, r);
+        if (src[mid] <= src[mid + 1]) copy(src + l, src + r + 1, dst + l);
+        else mergeSequential(src + l, mid - l + 1, src + mid + 1, r - mid, dst + l);
+    }
+
+    /**
+     * THE PARALLEL DIVIDER (same ping-pong invariant as sortSequential)
+     */
+    void sortParallel(int* dst, int* src, int l, int r) {
+        if (r - l + 1 <= SORT_CUTOFF) {
+            sortSequential(dst, src, l, r);
+            return;
+        }
+        int mid = l + (r - l) / 2;
+
+        // FORK: left half as a task, right half inline; then JOIN.
+        atomic<int> pending{1};
+        pool.spawn([&] {
+            sortParallel(src, dst, l, mid);
+            pending.fetch_sub(1, memory_order_release);
+        });
+        sortParallel(src, dst, mid + 1, r);
+        pool.join(pending);
+
+        if (src[mid] <= src[mid + 1]) copy(src + l, src + r + 1, dst + l);
+        else mergeParallel(src + l, mid - l + 1, src + mid + 1, r - mid, dst + l);
+    }
+
+public:
+    /**
+     * @param threads Pool workers (default: all hardware threads). The calling thread
+     * also runs tasks while it joins, so up to threads + 1 threads sort at once.
+     */
+    explicit Solution(int threads = thread::hardware_concurrency()) : pool(threads) {}
+
+    /**
+     * THE DISTRIBUTED DRIVER
+     * Sorts arr[l..r] in parallel. Drop-in replacement for the classic mergeSort.
+     */
+    void mergeSort(vector<int>& arr, int l, int r) {
+        if (l >= r) return;
+        if (scratch.size() < arr.size()) scratch.resize(arr.size());
+        int* a = arr.data();
+        int* b = scratch.data();
+
+        // The initial copy into the buffer is split across the pool as well.
+        int n = r - l + 1, chunks = pool.size();
+        atomic<int> pending{chunks};
+        for (int c = 0; c < chunks; c++) {
+            pool.spawn([&, c] {
+                int from = l + (long long)n * c / chunks, to = l + (long long)n * (c + 1) / chunks;
+                copy(a + from, a + to, b + from);
+                pending.fetch_sub(1, memory_order_release);
+            });
+        }
+        pool.join(pending);
+        sortParallel(a, b, l, r);
+    }
+
+    int threads() const { return pool.size(); }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
+    vector<int> data = {38, 27, 43, 3, 9, 82, 10, 27, -5};
+    int N = data.size();
+
+    cout << "INITIATING DISTRIBUTED MERGE PROTOCOL..." << endl;
+    printArray(data);
+    Solution(2).mergeSort(data, 0, N - 1);
+    printArray(data);
+    // Expected Output: [ -5, 3, 9, 10, 27, 27, 38, 43, 82 ]
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: scaling over pool sizes (speedup relative to workers=1, i.e. 2 threads) ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+    mt19937 rng(38);
+    vector<int> base(n);
+    for (int& x : base) x = (int)rng();
+
+    vector<int> expected = base;
+    auto t0 = chrono::steady_clock::now();
+    stable_sort(expected.begin(), expected.end());
+    auto t1 = chrono::steady_clock::now();
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    double baseline = ms(t0, t1);
+    cout << "BENCHMARK (N=" << n << "): std::stable_sort " << baseline << " ms" << endl;
+
+    vector<int> counts;
+    for (int p = 1; p < maxThreads; p *= 2) counts.push_back(p);
+    counts.push_back(maxThreads);
+
+    double single = 0;
+    for (int p : counts) {
+        Solution solver(p);
+        vector<int> work = base;
+        auto s0 = chrono::steady_clock::now();
+        solver.mergeSort(work, 0, n - 1);
+        auto s1 = chrono::steady_clock::now();
+        if (p == 1) single = ms(s0, s1);
+        // p pool workers, plus the calling thread, which also runs tasks inside join().
+        cout << "  workers=" << p << " (+1 caller): " << ms(s0, s1) << " ms (speedup " << single / ms(s0, s1) << "x) "
+             << (work == expected ? "[verified]" : "[MISMATCH]") << endl;
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file parallel_quick_sort.cpp
+ * @author LuShadowX
+ * @brief Task-parallel Quick Sort with a parallel (block + prefix-sum scatter) partition.
+ * @difficulty: Hard (Rank S)
+ * @tags: Sorting, Quick Sort, Parallel Algorithms, Work Stealing, Prefix Sum, Unstable Sort
+ * @logic: Forking the two recursive calls of quickSort is not enough: the first
+ * partition is a single O(N) pass on one core, followed by two O(N/2) passes on two
+ * cores, and so on. With P cores the speedup is then bounded by about log P.
+ * The top-level partitions are therefore parallel as well:
+ * 1. PIVOT: median of medians-of-3 over 9 evenly spaced samples.
+ * 2. COUNT: the segment is cut into blocks; each task counts how many of its
+ *    elements are < pivot, == pivot and > pivot.
+ * 3. PREFIX SUM: an exclusive scan over (class, block) gives each block a private
+ *    write window per class: no atomics, no contention, stable within a class.
+ * 4. SCATTER: each block copies its elements into its windows in the scratch buffer;
+ *    a parallel copy moves the segment back.
+ * Below PARALLEL_PARTITION cutoff the 3-way partition is sequential but the
+ * recursion still forks. Below the SEQUENTIAL cutoff the hardened quickSort of
+ * Quick_Sort.c++ finishes the segment.
+ * Recursion is fork-join on a work-stealing pool: the < and > sides run as tasks,
+ * and the == block is final.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Parallel Partition]
+ * Work: O(N) (two reads and two writes per element).
+ * Span: O(N / B + B) for B blocks (the scan is O(B) over 3B counters).
+ *
+ * [Whole Sort] (balanced pivots)
+ * Work: O(N log N).
+ * Span: O(N / P + log^2 N). No serial O(N) pass remains at the top.
+ *
+ * [Tunable Cutoffs]
+ * - sequentialCutoff: task granularity (too small: scheduling overhead; too
+ *   large: idle cores at the leaves).
+ * - parallelPartitionCutoff: below it the extra copy of the out-of-place
+ *   partition is not worth it.
+ * - blockSize: elements per counting/scatter block.
+ *
+ * [Space Complexity]
+ * O(N) scratch buffer (out-of-place partition), O(log N) stack per task.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Distributed Partition Protocol
+ * RANK: S (Parallel Divide & Conquer)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort very large integer arrays on many cores without a serial O(N) first pass,
+ * with every granularity threshold tunable per machine.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N / P + log^2 N) expected.
+ * - Space Complexity: O(N) auxiliary buffer, allocated once.
+ * - Stability: Unstable sort.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// Network base case of the leaf quickSort; global, so the nested copy is guarded out.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// The hardened sequential quickSort (introsort) used at the leaves.
+#pragma push_macro("main")
+#undef main
+#define main quick_sort_demo_main
+namespace quick_sort_impl {
+#include "Quick_Sort.c++"
+}
+#pragma pop_macro("main")
+
+// The work-stealing fork-join pool of the parallel merge sort, shared rather than copied.
+#pragma push_macro("main")
+#undef main
+#define main parallel_merge_sort_demo_main
+namespace parallel_merge_impl {
+#include "Parallel_Merge_Sort.c++"
+}
+#pragma pop_macro("main")
+using parallel_merge_impl::WorkStealingPool;
+
+// Tunable thresholds (all in elements).
+struct QuickSortCutoffs {
+    int sequentialCutoff = 1 << 15;          // Segment sorted by one task with quickSort
+    int parallelPartitionCutoff = 1 << 20;   // Segment partitioned by all workers
+    int blockSize = 1 << 16;                 // Elements per count/scatter block
+};
+
+class Solution {
+private:
+    WorkStealingPool pool;
+    QuickSortCutoffs cutoffs;
+    vector<int> scratch;
+
+    static int median3(int a, int b, int c) {
+        return max(min(a, b), min(max(a, b), c));
+    }
+
+    /**
+     * THE PIVOT SELECTOR
+     * Tukey's ninther over 9 evenly spaced samples of arr[low..high].
+     */
+    static int choosePivot(const int* a, int low, int high) {
+        long long n = high - low + 1;
+        auto at = [&](int k) { return a[low + n * k / 9 + n / 18]; };
+        return median3(median3(at(0), at(1), at(2)), median3(at(3), at(4), at(5)), median3(at(6), at(7), at(8)));
+    }
+
+    /**
+     * Runs body(block) for every block of [0, blocks) as a pool task and joins.
+     */
+    template <typename Body>
+    void forEachBlock(int blocks, Body&& body) {
+        atomic<int> pending{blocks};
+        for (int blk = 0; blk < blocks; blk++) {
+            pool.spawn([&, blk] {
+                body(blk);
+                pending.fetch_sub(1, memory_order_release);
+            });
+        }
+        pool.join(pending);
+    }
+
+    /**
+     * THE PARALLEL PARTITIONER
+     * Out-of-place 3-way partition of arr[low..high] around 'pivot' using all workers.
+     * @return {lt, gt}: the first and last index of the block equal to the pivot.
+     */
+    pair<int, int> parallelPartition(int* a, int low, int high, int pivot) {
+        int n = high - low + 1;
+        int blocks = max(1, min(n / cutoffs.blockSize, 8 * pool.size()));
+        auto blockBegin = [&](int blk) { return low + (int)((long long)n * blk / blocks); };
+
+        // COUNT: per-block class sizes.
+        vector<array<int, 3>> count(blocks);
+        forEachBlock(blocks, [&](int blk) {
+            int less = 0, equal = 0, from = blockBegin(blk), to = blockBegin(blk + 1);
+            for (int i = from; i < to; i++) {
+                less += a[i] < pivot;
+                equal += a[i] == pivot;
+            }
+            count[blk] = {less, equal, (to - from) - less - equal};
+        });
+
+        // PREFIX SUM: class-major, block-minor exclusive scan -> private write windows.
+        vector<array<int, 3>> offset(blocks);
+        int running = low;
+        for (int cls = 0; cls < 3; cls++) {
+            for (int blk = 0; blk < blocks; blk++) {
+                offset[blk][cls] = running;
+                running += count[blk][cls];
+            }
+        }
+        int lt = offset[0][1];
+        int gt = offset[0][2] - 1;
+
+        // SCATTER into the scratch buffer, then copy back in parallel.
+        int* s = scratch.data();
+        forEachBlock(blocks, [&](int blk) {
+            int pos[3] = {offset[blk][0], offset[blk][1], offset[blk][2]};
+            for (int i = blockBegin(blk), to = blockBegin(blk + 1); i < to; i++) {
+                int cls = (a[i] > pivot) + (a[i] >= pivot);   // 0: <, 1: ==, 2: >
+                s[pos[cls]++] = a[i];
+            }
+        });
+        forEachBlock(blocks, [&](int blk) {
+            copy(s + blockBegin(blk), s + blockBegin(blk + 1), a + blockBegin(blk));
+        });
+        return {lt, gt};
+    }
+
+    /**
+     * THE PARALLEL DIVIDER
+     * Partitions (in parallel above the cutoff), then forks the < and > sides.
+     */
+    void sortParallel(vector<int>& arr, int low, int high, int depthLimit) {
+        int n = high - low + 1;
+        if (n <= cutoffs.sequentialCutoff || depthLimit == 0) {
+            // Leaf (or too many bad pivots): the hardened introsort is O(N log N) regardless.
+            quick_sort_impl::Solution().quickSort(arr, low, high);
+            return;
+        }
+
+        int pivot = choosePivot(arr.data(), low, high);
+        pair<int, int> equal = n >= cutoffs.parallelPartitionCutoff
+            ? parallelPartition(arr.data(), low, high, pivot)
+            : quick_sort_impl::Solution().partition3(arr, low, high, pivot);
+        int lt = equal.first, gt = equal.second;
+
+        // FORK: left side as a task, right side inline; then JOIN.
+        atomic<int> pending{1};
+        pool.spawn([&] {
+            sortParallel(arr, low, lt - 1, depthLimit - 1);
+            pending.fetch_sub(1, memory_order_release);
+        });
+        sortParallel(arr, gt + 1, high, depthLimit - 1);
+        pool.join(pending);
+    }
+
+public:
+    /**
+     * @param threads Pool size (default: all hardware threads).
+     * @param cutoffs Granularity thresholds.
+     */
+    explicit Solution(int threads = thread::hardware_concurrency(), QuickSortCutoffs cutoffs = {})
+        : pool(threads), cutoffs(cutoffs) {}
+
+    /**
+     * THE DISTRIBUTED DRIVER
+     * Sorts arr[low..high] in parallel. Drop-in replacement for quickSort.
+     */
+    void quickSort(vector<int>& arr, int low, int high) {
+        if (low >= high) return;
+        if (high - low + 1 >= cutoffs.parallelPartitionCutoff && scratch.size() < arr.size()) {
+            scratch.resize(arr.size());
+        }
+        int depthLimit = 0;
+        for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;   // 2 * floor(log2 N)
+        sortParallel(arr, low, high, depthLimit);
+    }
+
+    int threads() const { return pool.size(); }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    // TEST CASE SETUP: tiny cutoffs so even 10 elements exercise the parallel partition.
+    vector<int> data = {4, 2, 8, 3, 1, 5, 7, 1, -2, 4};
+    int N = data.size();
+
+    cout << "INITIATING DISTRIBUTED PARTITION PROTOCOL..." << endl;
+    printArray(data);
+    QuickSortCutoffs tiny;
+    tiny.sequentialCutoff = 2;
+    tiny.parallelPartitionCutoff = 4;
+    tiny.blockSize = 2;
+    Solution(2, tiny).quickSort(data, 0, N - 1);
+    printArray(data);
+    // Expected Output: [ -2, 1, 1, 2, 3, 4, 4, 5, 7, 8 ]
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: scaling over thread counts ---
+    // Usage: ./a.out [N] [maxThreads] [sequentialCutoff] [parallelPartitionCutoff] [blockSize]
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+    QuickSortCutoffs tuned;
+    if (argc > 3) tuned.sequentialCutoff = atoi(argv[3]);
+    if (argc > 4) tuned.parallelPartitionCutoff = atoi(argv[4]);
+    if (argc > 5) tuned.blockSize = atoi(argv[5]);
+
+    mt19937 rng(41);
+    vector<int> base(n);
+    for (int& x : base) x = (int)rng();
+    vector<int> expected = base;
+    auto t0 = chrono::steady_clock::now();
+    sort(expected.begin(), expected.end());
+    auto t1 = chrono::steady_clock::now();
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "BENCHMARK (N=" << n << "): std::sort " << ms(t0, t1) << " ms" << endl;
+
+    vector<int> counts;
+    for (int p = 1; p < maxThreads; p *= 2) counts.push_back(p);
+    counts.push_back(maxThreads);
+
+    double single = 0;
+    for (int p : counts) {
+        Solution solver(p, tuned);
+        vector<int> work = base;
+        auto s0 = chrono::steady_clock::now();
+        solver.quickSort(work, 0, n - 1);
+        auto s1 = chrono::steady_clock::now();
+        if (p == 1) single = ms(s0, s1);
+        // p pool workers, plus the calling thread, which also runs tasks inside join().
+        cout << "  workers=" << p << " (+1 caller): " << ms(s0, s1) << " ms (speedup " << single / ms(s0, s1) << "x) "
+             << (work == expected ? "[verified]" : "[MISMATCH]") << endl;
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
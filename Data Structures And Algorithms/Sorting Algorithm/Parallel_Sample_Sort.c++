@@ -0,0 +1,367 @@
+/**
+ * @file parallel_sample_sort.cpp
+ * @author LuShadowX
+ * @brief Parallel super-scalar sample sort with a branchless splitter tree and NUMA-aware buckets.
+ * @difficulty: Hard (Rank S)
+ * @tags: Sorting, Sample Sort, Parallel Algorithms, NUMA, Branch Prediction, Prefix Sum
+ * @logic: Quicksort and merge sort move every element log2 N times. Sample sort
+ * picks K - 1 splitters up front and moves each element once into one of K buckets,
+ * then sorts the buckets independently (embarrassingly parallel):
+ * 1. SAMPLE: draw K * OVERSAMPLING random keys, sort them, take every
+ *    OVERSAMPLING-th as a splitter. Oversampling keeps buckets near N / K.
+ * 2. CLASSIFY (super-scalar, Sanders & Winkel 2004): the splitters are stored as
+ *    an implicit search tree (Eytzinger layout: children of i are 2i and 2i + 1).
+ *    Descending is i = 2i + (x > tree[i]): no branch. UNROLL elements descend in
+ *    lock-step so their independent loads overlap. Each thread classifies its
+ *    own chunk, stores the bucket ids (1 byte each) and counts per bucket.
+ * 3. PREFIX SUM over (bucket, thread) gives every thread a private write window in
+ *    every bucket; the scatter needs no atomics.
+ * 4. SORT: buckets are dealt out to threads in contiguous, size-balanced ranges;
+ *    each thread sorts its buckets and copies them back.
+ * NUMA: the output buffer is allocated uninitialized. Before the scatter, each
+ * thread first-touches the pages of the bucket range it will later sort, so the
+ * Linux first-touch policy places those pages on that thread's node. One set of
+ * threads runs all four phases (separated by a barrier), so the thread that
+ * touched a region is the one that later sorts it. With pinning on, threads are
+ * also bound to CPUs node by node (topology read from /sys/devices/system/node),
+ * so the scheduler cannot migrate them off that node. Bucket sorting and the
+ * copy-back then stay node-local, and only the single scatter pass crosses sockets.
+ * The caller (thread 0) gets its own CPU mask back when sampleSort returns.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Bucket Balance] With oversampling factor a, the largest of K buckets exceeds
+ * (1 + e) * N / K with probability <= K * exp(-e^2 * a / 3 (1 + e)) (Chernoff).
+ * a = 32 keeps the slowest bucket within a small factor of the mean.
+ *
+ * [Work]
+ * Classification: O(N log K).
+ * Scatter: O(N).
+ * Bucket sorts: O(N log(N / K)).
+ * Total: O(N log N), with one data movement pass instead of log N.
+ *
+ * [Span] O(N / P + N / K log(N / K)) for P threads.
+ *
+ * [Space Complexity] O(N) output buffer + N bytes of bucket ids + O(K * P) counters.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Sample & Scatter Protocol
+ * RANK: S (Parallel Distribution Sorting)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Sort large integer arrays on multi-socket machines with one global data
+ * movement pass, no contended atomics and node-local bucket processing.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N log N / P) expected.
+ * - Space Complexity: O(N) auxiliary.
+ * - Stability: Unstable sort.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+
+using namespace std;
+
+struct SampleSortOptions {
+    int threads = 0;                  // 0 = hardware concurrency
+    bool pinThreads = false;          // Bind threads to CPUs, grouped by NUMA node
+    int sequentialCutoff = 1 << 16;   // Below this the input is sorted on one thread
+};
+
+class Solution {
+private:
+    static constexpr int LOG_BUCKETS = 8;
+    static constexpr int BUCKETS = 1 << LOG_BUCKETS;   // Bucket id fits in one byte
+    static constexpr int OVERSAMPLING = 32;
+    static constexpr int UNROLL = 8;                   // Elements classified in lock-step
+
+    SampleSortOptions options;
+    vector<int> cpuOrder;   // CPUs listed node by node (for pinning)
+    atomic<bool> pinRefused{false};   // Set if any pthread_setaffinity_np call failed
+
+    // Reusable barrier separating the phases of one sampleSort call.
+    class PhaseBarrier {
+    private:
+        mutex m;
+        condition_variable cv;
+        int parties, waiting = 0;
+        long long generation = 0;
+
+    public:
+        explicit PhaseBarrier(int parties) : parties(parties) {}
+
+        void wait() {
+            unique_lock<mutex> lock(m);
+            long long gen = generation;
+            if (++waiting == parties) {
+                waiting = 0;
+                generation++;
+                cv.notify_all();
+                return;
+            }
+            cv.wait(lock, [&] { return generation != gen; });
+        }
+    };
+
+    /**
+     * CPU ids ordered by NUMA node, from /sys/devices/system/node/nodeN/cpulist.
+     * Falls back to 0..hardware_concurrency-1 when the topology is unavailable.
+     */
+    static vector<int> cpusByNode() {
+        vector<int> cpus;
+        for (int node = 0;; node++) {
+            ifstream f("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+            if (!f) break;
+            string list;
+            getline(f, list);
+            stringstream ss(list);
+            for (string range; getline(ss, range, ',');) {
+                size_t dash = range.find('-');
+                int lo = stoi(range.substr(0, dash));
+                int hi = dash == string::npos ? lo : stoi(range.substr(dash + 1));
+                for (int c = lo; c <= hi; c++) cpus.push_back(c);
+            }
+        }
+        if (cpus.empty()) {
+            for (int c = 0; c < (int)max(1u, thread::hardware_concurrency()); c++) cpus.push_back(c);
+        }
+        return cpus;
+    }
+
+    /**
+     * Runs job(t) for t in [0, threads), thread 0 being the caller. With pinning on,
+     * the caller's original CPU mask is restored afterwards.
+     */
+    template <typename Job>
+    void parallel(int threads, Job&& job) {
+        auto pin = [&](int t) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpuOrder[t % cpuOrder.size()], &set);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) pinRefused = true;
+        };
+        cpu_set_t callerMask;
+        bool restore = options.pinThreads &&
+                       pthread_getaffinity_np(pthread_self(), sizeof(callerMask), &callerMask) == 0;
+        vector<thread> pool;
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back([&, t] {
+                if (options.pinThreads) pin(t);
+                job(t);
+            });
+        }
+        if (options.pinThreads) pin(0);
+        job(0);
+        for (auto& th : pool) th.join();
+        if (restore && pthread_setaffinity_np(pthread_self(), sizeof(callerMask), &callerMask) != 0) {
+            pinRefused = true;
+        }
+    }
+
+    /**
+     * THE SPLITTER TREE CLASSIFIER (branchless)
+     * tree[1..BUCKETS-1] in Eytzinger order; writes bucket ids of a[0..n) to oracle.
+     */
+    static void classify(const int* tree, const int* a, int n, unsigned char* oracle, int* count) {
+        int i = 0;
+        for (; i + UNROLL <= n; i += UNROLL) {
+            int pos[UNROLL];
+            for (int u = 0; u < UNROLL; u++) pos[u] = 1;
+            for (int level = 0; level < LOG_BUCKETS; level++) {
+                for (int u = 0; u < UNROLL; u++) pos[u] = 2 * pos[u] + (a[i + u] > tree[pos[u]]);
+            }
+            for (int u = 0; u < UNROLL; u++) {
+                oracle[i + u] = (unsigned char)(pos[u] - BUCKETS);
+                count[pos[u] - BUCKETS]++;
+            }
+        }
+        for (; i < n; i++) {
+            int pos = 1;
+            for (int level = 0; level < LOG_BUCKETS; level++) pos = 2 * pos + (a[i] > tree[pos]);
+            oracle[i] = (unsigned char)(pos - BUCKETS);
+            count[pos - BUCKETS]++;
+        }
+    }
+
+    /**
+     * Builds the Eytzinger tree from sorted splitters s[0..BUCKETS-2].
+     */
+    static void buildTree(const vector<int>& splitters, vector<int>& tree, int node, int& next) {
+        if (node >= BUCKETS) return;
+        buildTree(splitters, tree, 2 * node, next);
+        tree[node] = splitters[next++];
+        buildTree(splitters, tree, 2 * node + 1, next);
+    }
+
+public:
+    explicit Solution(SampleSortOptions options = {}) : options(options), cpuOrder(cpusByNode()) {
+        if (this->options.threads <= 0) this->options.threads = max(1u, thread::hardware_concurrency());
+    }
+
+    /**
+     * THE DISTRIBUTED DRIVER
+     * Sorts arr[l..r] with parallel super-scalar sample sort.
+     */
+    void sampleSort(vector<int>& arr, int l, int r) {
+        if (l >= r) return;
+        int n = r - l + 1;
+        int* a = arr.data() + l;
+        int threads = max(1, min(options.threads, n / options.sequentialCutoff));
+        if (n < options.sequentialCutoff || n < BUCKETS * OVERSAMPLING) {
+            sort(a, a + n);
+            return;
+        }
+
+        // SAMPLE: oversampled splitters -> implicit search tree.
+        mt19937 rng(n);
+        uniform_int_distribution<int> pick(0, n - 1);
+        vector<int> sample(BUCKETS * OVERSAMPLING);
+        for (int& s : sample) s = a[pick(rng)];
+        sort(sample.begin(), sample.end());
+        vector<int> splitters(BUCKETS - 1);
+        for (int b = 1; b < BUCKETS; b++) splitters[b - 1] = sample[b * OVERSAMPLING];
+        vector<int> tree(BUCKETS);
+        int next = 0;
+        buildTree(splitters, tree, 1, next);
+
+        // One thread set runs every phase; the barrier separates them.
+        unique_ptr<unsigned char[]> oracle(new unsigned char[n]);
+        unique_ptr<int[]> out(new int[n]);   // Uninitialized: pages are placed by first touch
+        vector<vector<int>> count(threads, vector<int>(BUCKETS, 0));
+        vector<vector<int>> offset(threads, vector<int>(BUCKETS));
+        vector<int> bucketBegin(BUCKETS + 1);
+        vector<int> firstBucket(threads + 1, BUCKETS);
+        auto chunkBegin = [&](int t) { return (int)((long long)n * t / threads); };
+        PhaseBarrier barrier(threads);
+
+        parallel(threads, [&](int t) {
+            // CLASSIFY: per-thread chunk, bucket ids into the (uninitialized) oracle.
+            int chunkFrom = chunkBegin(t), chunkTo = chunkBegin(t + 1);
+            classify(tree.data(), a + chunkFrom, chunkTo - chunkFrom, oracle.get() + chunkFrom, count[t].data());
+            barrier.wait();
+
+            if (t == 0) {
+                // PREFIX SUM: bucket-major, thread-minor -> private windows.
+                int running = 0;
+                for (int b = 0; b < BUCKETS; b++) {
+                    bucketBegin[b] = running;
+                    for (int u = 0; u < threads; u++) {
+                        offset[u][b] = running;
+                        running += count[u][b];
+                    }
+                }
+                bucketBegin[BUCKETS] = n;
+
+                // OWNERSHIP: contiguous bucket ranges of ~N / P elements per thread.
+                firstBucket[0] = 0;
+                for (int u = 1, b = 0; u < threads; u++) {
+                    while (b < BUCKETS && bucketBegin[b] < (long long)n * u / threads) b++;
+                    firstBucket[u] = max(b, firstBucket[u - 1]);
+                }
+            }
+            barrier.wait();
+
+            // FIRST TOUCH: each owner faults in its region of the output buffer.
+            int from = bucketBegin[firstBucket[t]], to = bucketBegin[firstBucket[t + 1]];
+            for (int i = from; i < to; i += 1024) out[i] = 0;
+            barrier.wait();
+
+            // SCATTER: every thread writes its chunk into its private windows.
+            int* pos = offset[t].data();
+            const unsigned char* id = oracle.get();
+            for (int i = chunkFrom; i < chunkTo; i++) out[pos[id[i]]++] = a[i];
+            barrier.wait();
+
+            // SORT + COPY BACK: each owner handles its node-local buckets.
+            for (int b = firstBucket[t]; b < firstBucket[t + 1]; b++) {
+                sort(out.get() + bucketBegin[b], out.get() + bucketBegin[b + 1]);
+            }
+            memcpy(a + from, out.get() + from, sizeof(int) * (to - from));
+        });
+    }
+
+    int threads() const { return options.threads; }
+
+    /**
+     * @return false if the kernel refused a CPU binding (threads then ran unpinned).
+     */
+    bool pinningHonored() const { return !pinRefused.load(); }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
+    vector<int> data = {4, 2, 8, 3, 1, 5, 7, 1, -2, 4};
+    int N = data.size();
+
+    cout << "INITIATING SAMPLE & SCATTER PROTOCOL..." << endl;
+    printArray(data);
+    Solution().sampleSort(data, 0, N - 1);
+    printArray(data);
+    // Expected Output: [ -2, 1, 1, 2, 3, 4, 4, 5, 7, 8 ]
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: scaling over thread counts (argv: N maxThreads pin) ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+    bool pin = argc > 3 && atoi(argv[3]) != 0;
+    mt19937 rng(43);
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    for (string kind : {"random", "few unique"}) {
+        vector<int> base(n);
+        for (int& x : base) x = kind == "random" ? (int)rng() : (int)(rng() % 100);
+        vector<int> expected = base;
+        auto t0 = chrono::steady_clock::now();
+        sort(expected.begin(), expected.end());
+        auto t1 = chrono::steady_clock::now();
+        cout << "BENCHMARK " << kind << " (N=" << n << "): std::sort " << ms(t0, t1) << " ms" << endl;
+
+        vector<int> counts;
+        for (int p = 1; p < maxThreads; p *= 2) counts.push_back(p);
+        counts.push_back(maxThreads);
+        for (int p : counts) {
+            SampleSortOptions opt;
+            opt.threads = p;
+            opt.pinThreads = pin;
+            Solution solver(opt);
+            vector<int> work = base;
+            auto s0 = chrono::steady_clock::now();
+            solver.sampleSort(work, 0, n - 1);
+            auto s1 = chrono::steady_clock::now();
+            string mode = !pin ? "" : solver.pinningHonored() ? " (pinned)" : " (pinning refused)";
+            cout << "  threads=" << p << mode << ": " << ms(s0, s1) << " ms ("
+                 << ms(t0, t1) / ms(s0, s1) << "x vs std::sort) " << (work == expected ? "[verified]" : "[MISMATCH]") << endl;
+        }
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
@@ -0,0 +1,337 @@
+/**
+ * @file quick_select.cpp
+ * @author LuShadowX
+ * @brief Selection on the Quick Sort partition: nthElement, partialSort and topK
+ * (introselect with a median-of-medians guard), plus a streaming heap top-K.
+ * @difficulty: Medium-Hard (Rank A)
+ * @tags: Selection, Quickselect, Introselect, Median of Medians, Heap, Top-K
+ * @logic: Sorting N elements to read the first 100 does N log N work for an
+ * O(N) question. Quickselect partitions like Quick Sort but keeps only the side
+ * that contains position k:
+ * - Partition: Solution::partition3 from Quick_Sort.c++ (3-way, so runs of equal
+ *   keys end the search at once). Pivot: median-of-3 / ninther, as in quickSort.
+ * - Guard (introselect): after 2 * floor(log2 N) rounds without finishing, the
+ *   pivot becomes the median of medians of groups of 5 (BFPRT), which keeps at
+ *   least 30% of the range on each side. The worst case is then O(N), not O(N^2).
+ * - partialSort: select position k - 1, then sort only the k smallest with quickSort.
+ * - topK: the k largest, descending, by selection on a copy.
+ * - TopKStream: a min-heap of the k largest elements seen so far. One comparison
+ *   against the heap root rejects almost every element. Memory is O(k), so the
+ *   input can be a stream that never fits in RAM.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Quickselect] Expected comparisons ~ 2N to 3.4N (depending on k).
+ * T(N) = T(a N) + O(N) with a < 1 -> O(N).
+ *
+ * [Median of Medians] At least 3 * ceil(ceil(N/5) / 2) - 6 ~ 3N/10 elements lie
+ * on each side of the pivot:
+ * T(N) <= T(N/5) + T(7N/10) + O(N) -> O(N) worst case.
+ *
+ * [partialSort] O(N + k log k).
+ * [TopKStream]  O(N log k) worst case, ~N + O(k log k log(N/k)) expected on
+ * random order; O(k) memory.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Selective Extraction Protocol
+ * RANK: A (Order Statistics)
+ * DEPARTMENT: Algorithmic Sorting & Recursive Optimization
+ * CHALLENGE:
+ * Answer "k-th smallest", "k smallest in order" and "top k" queries without
+ * sorting everything, in linear worst-case time, and over unbounded streams.
+ * CONSTRAINTS:
+ * - Time Complexity: O(N) for nthElement / topK, O(N + k log k) for partialSort.
+ * - Space Complexity: O(1) extra (nthElement, partialSort), O(k) for TopKStream.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace std;
+
+// Quick_Sort.c++'s network base case, at global scope before Quick_Sort.c++ is nested.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// The partition and sort being extended.
+#pragma push_macro("main")
+#undef main
+#define main quick_sort_demo_main
+namespace quick_sort_impl {
+#include "Quick_Sort.c++"
+}
+#pragma pop_macro("main")
+
+/**
+ * THE STREAMING SELECTOR
+ * Keeps the k largest values pushed so far in a min-heap (root = smallest kept).
+ */
+class TopKStream {
+private:
+    int k;
+    vector<int> heap;
+
+    void siftUp(int i) {
+        int value = heap[i];
+        while (i > 0 && heap[(i - 1) / 2] > value) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = value;
+    }
+
+    void siftDown(int i) {
+        int n = heap.size();
+        int value = heap[i];
+        while (2 * i + 1 < n) {
+            int child = 2 * i + 1;
+            if (child + 1 < n && heap[child + 1] < heap[child]) child++;
+            if (heap[child] >= value) break;
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = value;
+    }
+
+public:
+    explicit TopKStream(int k) : k(max(k, 0)) { heap.reserve(this->k); }
+
+    void push(int x) {
+        if ((int)heap.size() < k) {
+            heap.push_back(x);
+            siftUp(heap.size() - 1);
+        } else if (k > 0 && x > heap[0]) {
+            heap[0] = x;   // Replace the smallest kept value
+            siftDown(0);
+        }
+    }
+
+    /**
+     * The kept values, largest first.
+     */
+    vector<int> result() const {
+        vector<int> out = heap;
+        sort(out.begin(), out.end(), greater<int>());
+        return out;
+    }
+};
+
+class Solution {
+private:
+    static constexpr int INSERTION_CUTOFF = 16;   // As in Quick_Sort.c++
+    static constexpr int NINTHER_THRESHOLD = 40;
+
+    quick_sort_impl::Solution sorter;   // partition3 and quickSort
+
+    void insertionSort(vector<int>& arr, int low, int high) {
+        for (int i = low + 1; i <= high; i++) {
+            int key = arr[i];
+            int j = i - 1;
+            while (j >= low && arr[j] > key) {
+                arr[j + 1] = arr[j];
+                j--;
+            }
+            arr[j + 1] = key;
+        }
+    }
+
+    int median3(const vector<int>& arr, int a, int b, int c) {
+        if (arr[a] < arr[b]) {
+            if (arr[b] < arr[c]) return b;
+            return arr[a] < arr[c] ? c : a;
+        }
+        if (arr[a] < arr[c]) return a;
+        return arr[b] < arr[c] ? c : b;
+    }
+
+    /**
+     * Median-of-3 for small segments; Tukey's ninther for large ones.
+     */
+    int choosePivot(const vector<int>& arr, int low, int high) {
+        int n = high - low + 1;
+        int mid = low + n / 2;
+        if (n <= NINTHER_THRESHOLD) return median3(arr, low, mid, high);
+        int step = n / 8;
+        int a = median3(arr, low, low + step, low + 2 * step);
+        int b = median3(arr, mid - step, mid, mid + step);
+        int c = median3(arr, high - 2 * step, high - step, high);
+        return median3(arr, a, b, c);
+    }
+
+    /**
+     * THE GUARANTEED PIVOT (BFPRT)
+     * Sorts each group of 5, gathers the group medians at the front of the range
+     * and returns their median (found by guaranteed selection).
+     */
+    int medianOfMedians(vector<int>& arr, int low, int high) {
+        int n = high - low + 1;
+        if (n <= 5) {
+            insertionSort(arr, low, high);
+            return arr[low + n / 2];
+        }
+        int groups = 0;
+        for (int g = low; g <= high; g += 5) {
+            int gHigh = min(g + 4, high);
+            insertionSort(arr, g, gHigh);
+            swap(arr[low + groups++], arr[g + (gHigh - g) / 2]);
+        }
+        return select(arr, low, low + groups - 1, low + groups / 2, true);
+    }
+
+    /**
+     * THE SELECTION LOOP
+     * Narrows [low, high] to the side holding index k.
+     * @param guaranteed Use median-of-medians pivots from the start.
+     */
+    int select(vector<int>& arr, int low, int high, int k, bool guaranteed) {
+        int budget = 0;
+        for (int n = high - low + 1; n > 1; n >>= 1) budget += 2;   // 2 * floor(log2 N) fast rounds
+
+        while (high - low + 1 > INSERTION_CUTOFF) {
+            if (budget-- == 0) guaranteed = true;
+            int pivot = guaranteed ? medianOfMedians(arr, low, high) : arr[choosePivot(arr, low, high)];
+            pair<int, int> equal = sorter.partition3(arr, low, high, pivot);
+            if (k < equal.first) high = equal.first - 1;
+            else if (k > equal.second) low = equal.second + 1;
+            else return arr[k];   // k landed in the block equal to the pivot
+        }
+        insertionSort(arr, low, high);
+        return arr[k];
+    }
+
+public:
+    /**
+     * THE SELECTOR
+     * Rearranges arr[low..high] so that arr[k] holds the value it would have if the
+     * range were sorted, with arr[low..k-1] <= arr[k] <= arr[k+1..high].
+     * @param k Absolute index, low <= k <= high.
+     * @return arr[k].
+     */
+    int nthElement(vector<int>& arr, int low, int high, int k) {
+        return select(arr, low, high, k, false);
+    }
+
+    /**
+     * THE PARTIAL SORTER
+     * Places the k smallest elements of arr[low..high], sorted, in arr[low..low+k-1].
+     * The order of the remaining elements is unspecified.
+     */
+    void partialSort(vector<int>& arr, int low, int high, int k) {
+        k = min(k, high - low + 1);
+        if (k <= 0) return;
+        nthElement(arr, low, high, low + k - 1);
+        sorter.quickSort(arr, low, low + k - 2);   // arr[low+k-1] is already in place
+    }
+
+    /**
+     * THE TOP-K EXTRACTOR
+     * @return The k largest elements of arr, largest first (arr is not modified).
+     */
+    vector<int> topK(const vector<int>& arr, int k) {
+        int n = arr.size();
+        k = min(k, n);
+        if (k <= 0) return {};
+        vector<int> work = arr;
+        nthElement(work, 0, n - 1, n - k);
+        vector<int> out(work.begin() + (n - k), work.end());
+        sort(out.begin(), out.end(), greater<int>());
+        return out;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+void printArray(const vector<int>& arr) {
+    cout << "[ ";
+    for (size_t i = 0; i < arr.size(); ++i) {
+        cout << arr[i] << (i == arr.size() - 1 ? "" : ", ");
+    }
+    cout << " ]" << endl;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+
+    // TEST CASE SETUP: An unsorted array containing duplicates and negative numbers.
+    vector<int> data = {4, 2, 8, 3, 1, 5, 7, 1, -2, 4};
+    int N = data.size();
+
+    cout << "INITIATING SELECTIVE EXTRACTION PROTOCOL..." << endl;
+    printArray(data);
+    vector<int> work = data;
+    cout << "Median (index " << N / 2 << "): " << solver.nthElement(work, 0, N - 1, N / 2) << endl;
+    // Expected Output: 4
+    work = data;
+    solver.partialSort(work, 0, N - 1, 4);
+    cout << "4 smallest: ";
+    printArray(vector<int>(work.begin(), work.begin() + 4));
+    // Expected Output: [ -2, 1, 1, 2 ]
+    cout << "Top 3: ";
+    printArray(solver.topK(data, 3));
+    // Expected Output: [ 8, 7, 5 ]
+    TopKStream stream(3);
+    for (int x : data) stream.push(x);
+    cout << "Top 3 (stream): ";
+    printArray(stream.result());
+    // Expected Output: [ 8, 7, 5 ]
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: top 100 of N, selection vs sorting everything ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    int k = argc > 2 ? atoi(argv[2]) : 100;
+    mt19937 rng(47);
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "BENCHMARK (N=" << n << ", k=" << k << ", ms):" << endl;
+    for (string kind : {"random", "sorted", "reversed", "organ pipe", "few unique"}) {
+        vector<int> base(n);
+        for (int i = 0; i < n; i++) {
+            base[i] = kind == "random" ? (int)rng() : kind == "sorted" ? i : kind == "reversed" ? n - i
+                    : kind == "organ pipe" ? min(i, n - i) : (int)(rng() % 16);
+        }
+        vector<int> expected = base;
+        auto t0 = chrono::steady_clock::now();
+        quick_sort_impl::Solution().quickSort(expected, 0, n - 1);
+        auto t1 = chrono::steady_clock::now();
+        reverse(expected.begin(), expected.end());
+        expected.resize(k);
+
+        vector<int> a = base;
+        auto t2 = chrono::steady_clock::now();
+        nth_element(a.begin(), a.begin() + n / 2, a.end());
+        auto t3 = chrono::steady_clock::now();
+        vector<int> b = base;
+        int median = solver.nthElement(b, 0, n - 1, n / 2);
+        auto t4 = chrono::steady_clock::now();
+        vector<int> top = solver.topK(base, k);
+        auto t5 = chrono::steady_clock::now();
+        TopKStream s(k);
+        for (int x : base) s.push(x);
+        vector<int> streamed = s.result();
+        auto t6 = chrono::steady_clock::now();
+        vector<int> c = base;
+        solver.partialSort(c, 0, n - 1, k);
+        auto t7 = chrono::steady_clock::now();
+
+        vector<int> smallest = base;
+        partial_sort(smallest.begin(), smallest.begin() + k, smallest.end());
+        bool ok = median == a[n / 2] && top == expected && streamed == expected &&
+                  equal(c.begin(), c.begin() + k, smallest.begin());
+        cout << "  " << kind << ": full quickSort " << ms(t0, t1) << " | median: std::nth_element " << ms(t2, t3)
+             << ", nthElement " << ms(t3, t4) << " | topK " << ms(t4, t5) << ", TopKStream " << ms(t5, t6)
+             << ", partialSort " << ms(t6, t7) << (ok ? " [verified]" : " [MISMATCH]") << endl;
+    }
+    cout << "MISSION COMPLETE." << endl;
+    return 0;
+}
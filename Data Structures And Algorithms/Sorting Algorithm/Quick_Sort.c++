@@ -11,6 +11,16 @@
  * is now in its final sorted position.
  * 3. Recursion: Recursively apply the above steps to the sub-array to the left
  * of the pivot and the sub-array to the right of the pivot.
+ * Hardening (introsort-grade driver used by quickSort):
+ * - Pivot: median-of-3, or Tukey's ninther (median of three medians) for N > 40,
+ *   so sorted, reversed and organ-pipe inputs still split near the middle.
+ * - 3-way (Dutch national flag) partition: keys equal to the pivot are gathered in
+ *   the middle and never recursed on, so all-equal input is O(N).
+ * - Depth limit 2 * floor(log2 N): past it the segment is heapsorted (O(N log N) cap).
+ * - Recurse on the smaller side, loop on the larger: stack depth O(log N).
+ * - Base case: segments of at most NETWORK_CUTOFF elements go to a branch-free
+ *   AVX2/AVX-512 bitonic sorting network (Sorting_Network.c++, picked at runtime);
+ *   without SIMD, segments of at most INSERTION_CUTOFF are insertion-sorted.
  */
 
 /**
@@ -32,6 +42,12 @@
  * [Space Complexity]
  * O(log N) on average due to recursion stack depth. O(N) in worst case.
  * Unlike Merge Sort, Quick Sort is an in-place sort (O(1) auxiliary array space).
+ *
+ * [Hardened Bounds]
+ * Smaller-side recursion: each frame's segment is at most half its parent's,
+ * so depth <= log2 N in every case.
+ * The heapsort fallback after 2 log2 N levels caps the worst case at O(N log N)
+ * (introsort, Musser 1997).
  * ============================================================================
  */
 
@@ -44,45 +60,158 @@
  * pivot element, placing the pivot in its correct sorted position, and
  * recursively sorting the surrounding sub-arrays.
  * CONSTRAINTS:
- * - Time Complexity: O(N log N) average, O(N^2) worst case.
- * - Space Complexity: O(log N) average stack space.
+ * - Time Complexity: O(N log N) average and worst case (introsort fallback).
+ * - Space Complexity: O(log N) stack space, guaranteed.
  * - Stability: Unstable sort (relative order of equal elements might change).
  */
 
 #include <iostream>
 #include <vector>
 #include <algorithm> // For std::swap
+#include <chrono>
+#include <random>
+#include <string>
 
 using namespace std;
 
+// Vectorized base case: bitonic sorting networks with runtime CPU dispatch. The file
+// is include-guarded and brings its own namespace, sorting_network_impl.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
 class Solution {
+private:
+    static constexpr int INSERTION_CUTOFF = 16;   // Scalar base case: insertion sort
+    static constexpr int NETWORK_CUTOFF = 64;     // SIMD base case: sorting network
+    static constexpr int NINTHER_THRESHOLD = 40;  // Above this size the pivot is a ninther
+
+    using Network = sorting_network_impl::Solution;
+
+    Network network;   // Base-case sorter (AVX-512 / AVX2 / insertion sort)
+    int baseCutoff;
+
+    /**
+     * Index of the median of arr[a], arr[b], arr[c].
+     */
+    int median3(const vector<int>& arr, int a, int b, int c) {
+        if (arr[a] < arr[b]) {
+            if (arr[b] < arr[c]) return b;
+            return arr[a] < arr[c] ? c : a;
+        }
+        if (arr[a] < arr[c]) return a;
+        return arr[b] < arr[c] ? c : b;
+    }
+
+    /**
+     * THE PIVOT SELECTOR
+     * Median-of-3 for small segments; Tukey's ninther for large ones.
+     */
+    int choosePivot(const vector<int>& arr, int low, int high) {
+        int n = high - low + 1;
+        int mid = low + n / 2;
+        if (n <= NINTHER_THRESHOLD) return median3(arr, low, mid, high);
+        int step = n / 8;
+        int a = median3(arr, low, low + step, low + 2 * step);
+        int b = median3(arr, mid - step, mid, mid + step);
+        int c = median3(arr, high - 2 * step, high - step, high);
+        return median3(arr, a, b, c);
+    }
+
+    void siftDown(vector<int>& arr, int low, int root, int n) {
+        int value = arr[low + root];
+        while (2 * root + 1 < n) {
+            int child = 2 * root + 1;
+            if (child + 1 < n && arr[low + child] < arr[low + child + 1]) child++;
+            if (arr[low + child] <= value) break;
+            arr[low + root] = arr[low + child];
+            root = child;
+        }
+        arr[low + root] = value;
+    }
+
+    /**
+     * THE SAFETY NET
+     * In-place heapsort of arr[low..high]; O(N log N) regardless of input.
+     */
+    void heapSort(vector<int>& arr, int low, int high) {
+        int n = high - low + 1;
+        for (int i = n / 2 - 1; i >= 0; i--) siftDown(arr, low, i, n);
+        for (int end = n - 1; end > 0; end--) {
+            swap(arr[low], arr[low + end]);
+            siftDown(arr, low, 0, end);
+        }
+    }
+
+    /**
+     * THE INTROSORT LOOP
+     * Recurses on the smaller side, iterates on the larger one.
+     */
+    void introSort(vector<int>& arr, int low, int high, int depthLimit) {
+        while (high - low + 1 > baseCutoff) {
+            if (depthLimit-- == 0) {
+                heapSort(arr, low, high);
+                return;
+            }
+            pair<int, int> equal = partition3(arr, low, high, arr[choosePivot(arr, low, high)]);
+            int lt = equal.first, gt = equal.second;
+
+            if (lt - low < high - gt) {
+                introSort(arr, low, lt - 1, depthLimit);
+                low = gt + 1;
+            } else {
+                introSort(arr, gt + 1, high, depthLimit);
+                high = lt - 1;
+            }
+        }
+        network.sortSmall(arr, low, high);
+    }
+
 public:
+    /**
+     * @param isa Base-case instruction set (default: the best this CPU has).
+     */
+    explicit Solution(Network::Isa isa = Network::detect())
+        : network(isa), baseCutoff(network.activeIsa() == Network::SCALAR ? INSERTION_CUTOFF : NETWORK_CUTOFF) {}
+
     /**
      * THE RECURSIVE DRIVER
-     * Main function to execute Quick Sort recursively.
+     * Main function to execute the hardened (introsort-grade) Quick Sort.
      * @param arr The vector to be sorted.
      * @param low The starting index of the current segment.
      * @param high The ending index of the current segment.
      */
     void quickSort(vector<int>& arr, int low, int high) {
         // Base condition: If the array has 0 or 1 element, it is sorted.
-        if (low < high) {
+        if (low >= high) return;
 
-            // Partition the array and get the pivot's final index
-            int part = partition(arr, low, high);
+        int depthLimit = 0;
+        for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;   // 2 * floor(log2 N)
+        introSort(arr, low, high, depthLimit);
+    }
 
-            // Recursively sort the left part (before pivot)
-            quickSort(arr, low, part - 1);
-            
-            // Recursively sort the right part (after pivot)
-            quickSort(arr, part + 1, high);
+    /**
+     * THE 3-WAY PARTITIONER (Dutch National Flag)
+     * Rearranges arr[low..high] into [ < pivot | == pivot | > pivot ].
+     * @return {lt, gt}: the first and last index of the block equal to the pivot.
+     */
+    pair<int, int> partition3(vector<int>& arr, int low, int high, int pivot) {
+        int lt = low, i = low, gt = high;
+        while (i <= gt) {
+            if (arr[i] < pivot) swap(arr[lt++], arr[i++]);
+            else if (arr[i] > pivot) swap(arr[i], arr[gt--]);
+            else i++;
         }
+        return {lt, gt};
     }
 
     /**
-     * THE PARTITIONER (Core Logic)
+     * THE PARTITIONER (Classic 2-Way)
      * Rearranges the array around a pivot.
-     * Uses the first element as the pivot.
+     * Uses the first element as the pivot. Kept as the single-step API; quickSort
+     * itself partitions with partition3.
      * @param arr The vector to partition.
      * @param low The starting index.
      * @param high The ending index.
@@ -133,7 +262,7 @@ void printArray(const vector<int>& arr) {
     cout << " ]" << endl;
 }
 
-int main() {
+int main(int argc, char** argv) {
     Solution solver;
 
     // TEST CASE SETUP: An unsorted array containing duplicates, negative numbers, and already sorted sections.
@@ -154,7 +283,33 @@ int main() {
     printArray(data);
     cout << "-----------------------------" << endl;
     
-    cout << "Time Complexity Note: O(N log N) average case achieved." << endl;
+    // --- Benchmark: adversarial inputs that broke the first-element pivot ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    mt19937 rng(39);
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "BENCHMARK (N=" << n << ", ms, network: "
+         << sorting_network_impl::Solution::isaName(sorting_network_impl::Solution::detect()) << "):" << endl;
+    for (string kind : {"random", "sorted", "reversed", "all equal", "organ pipe", "few unique"}) {
+        vector<int> base(n);
+        for (int i = 0; i < n; i++) {
+            base[i] = kind == "random" ? (int)rng() : kind == "sorted" ? i : kind == "reversed" ? n - i
+                    : kind == "all equal" ? 7 : kind == "organ pipe" ? min(i, n - i) : (int)(rng() % 16);
+        }
+        vector<int> expected = base, scalarBase = base;
+        auto t0 = chrono::steady_clock::now();
+        sort(expected.begin(), expected.end());
+        auto t1 = chrono::steady_clock::now();
+        Solution(sorting_network_impl::Solution::SCALAR).quickSort(scalarBase, 0, n - 1);
+        auto t2 = chrono::steady_clock::now();
+        solver.quickSort(base, 0, n - 1);
+        auto t3 = chrono::steady_clock::now();
+        cout << "  " << kind << ": std::sort " << ms(t0, t1) << ", quickSort (insertion base) " << ms(t1, t2)
+             << ", quickSort (network base) " << ms(t2, t3)
+             << (base == expected && scalarBase == expected ? " [verified]" : " [MISMATCH]") << endl;
+    }
+    cout << "-----------------------------" << endl;
+
+    cout << "Time Complexity Note: O(N log N) worst case guaranteed." << endl;
     cout << "MISSION COMPLETE." << endl;
 
     // Expected Output: [ -2, 1, 1, 2, 3, 4, 4, 5, 7, 8 ]
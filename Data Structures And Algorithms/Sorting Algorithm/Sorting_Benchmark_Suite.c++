@@ -0,0 +1,617 @@
+/**
+ * @file sorting_benchmark_suite.cpp
+ * @author LuShadowX
+ * @brief Benchmark harness for every in-memory sort in Sorting Algorithm/ on
+ * adversarial and distribution-aware inputs from 10 to 10^9 elements.
+ * @difficulty: Medium (Rank A)
+ * @tags: Sorting, Benchmarking, Input Distributions, Zipf, Quicksort Killer, perf_event
+ * @logic: The demo main() of each sort proves correctness on ~10 elements. This
+ * binary compiles the real sort files unchanged: each is included inside its own
+ * namespace with its main() renamed, so the benchmark always measures the code that
+ * lives in the repository.
+ * 1. GENERATE: random, sorted, reverse, organ-pipe, few-unique (16 keys), Zipfian
+ *    (s = 1), and a quicksort killer: McIlroy's adversary ("A Killer Adversary for
+ *    Quicksort", 1999) run against the generic introsort, which uses the same
+ *    ninther + 3-way partition as Quick_Sort.c++.
+ * 2. RUN: std::sort / std::stable_sort as references, then every repository sort.
+ *    Small sizes are repeated on back-to-back copies until ~1M elements have been
+ *    sorted, so timer resolution does not dominate ns/element.
+ * 3. COUNT: comparisons and element moves, in a separate untimed pass:
+ *    - std:: and Generic_Sort.c++: a counting comparator and a counting element type.
+ *    - radix_lsd: 0 comparisons; n moves per digit pass Radix_Sort.c++ executes
+ *      (same pass-skip rule) plus n for the copy back after an odd number of passes.
+ *    - merge, natural_merge, bottom_up_merge, parallel_merge, quick, block_quick,
+ *      parallel_quick, american_flag and sample are written for vector<int> and
+ *      compare raw ints, so no comparator or element type can be substituted
+ *      without changing the code being timed: they report -1 (not measured).
+ *      Only instructions and branch misses describe them, and only where
+ *    perf_event_open is permitted.
+ * 4. REPORT: ns/element, comparisons, moves, instructions and branch misses
+ *    (perf_event_open, when the kernel allows it, else -1), the peak heap the sort
+ *    allocated and a verification flag, as CSV or JSON.
+ */
+
+/**
+ * ============================================================================
+ * MEASUREMENT METHODOLOGY
+ * ============================================================================
+ * [Throughput]
+ * ns/element = wall time of all repetitions / (n * repetitions). Copying the input
+ * into the work buffer is not timed.
+ *
+ * [Hardware Counters]
+ * One perf_event group (instructions, branch-misses), user space only, on the
+ * calling thread. The parallel sorts' worker threads are not included, so their
+ * counters show only the caller's share.
+ *
+ * [Peak Memory]
+ * peak_heap_kb = the highest number of live heap bytes during the run minus those
+ * live when it started. This binary replaces the global operator new / delete with
+ * counting versions (sized by malloc_usable_size, on every thread), so the column is
+ * what the sort itself allocates, whatever earlier runs freed: about 4n bytes for a
+ * merge sort's buffer, 0 for an in-place sort. Every (input, sort) pair gets freshly
+ * constructed solvers, built before the baseline, so scratch buffers that grow lazily
+ * are charged to the run that needs them; thread pools and their stacks are not.
+ * Direct malloc calls and thread stacks are outside operator new and not counted.
+ *
+ * [Counting Pass]
+ * Comparisons and moves come from a separate, untimed run on one copy of the input
+ * (n <= --count-limit), so the instrumentation never distorts the timings. A move
+ * is one element copy or move assignment/construction (std::swap = 3 moves).
+ * -1 means not measured (see COUNT above), never zero.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Sorting Performance Audit
+ * RANK: A (Benchmark Infrastructure)
+ * DEPARTMENT: Algorithmic Sorting & Performance Engineering
+ * CHALLENGE:
+ * Measure every sort on every input shape and size and emit machine-readable results.
+ * USAGE:
+ *   ./sort_bench [--sizes=10,1000,100000,1000000] [--inputs=random,sorted,reverse,organ,few,zipf,killer]
+ *                [--sorts=std_sort,std_stable,merge,natural_merge,bottom_up_merge,parallel_merge,quick,
+ *                 block_quick,parallel_quick,radix_lsd,american_flag,sample,generic_merge,generic_quick]
+ *                [--threads=T] [--count-limit=N] [--format=csv|json] [--seed=S]
+ */
+
+#include <bits/stdc++.h>
+#include <linux/perf_event.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Shared by the merge sorts and quicksorts below: one global copy of the network.
+#pragma push_macro("main")
+#undef main
+#define main sorting_network_demo_main
+#include "Sorting_Network.c++"
+#pragma pop_macro("main")
+
+// ---- Heap accounting: every operator new / delete in the process goes through here ----
+namespace heap_stats {
+atomic<long long> live{0}, peak{0};
+
+inline void allocated(void* p) {
+    long long now = live.fetch_add(malloc_usable_size(p), memory_order_relaxed) + malloc_usable_size(p);
+    long long seen = peak.load(memory_order_relaxed);
+    while (now > seen && !peak.compare_exchange_weak(seen, now, memory_order_relaxed)) {
+    }
+}
+
+inline void released(void* p) {
+    if (p) live.fetch_sub(malloc_usable_size(p), memory_order_relaxed);
+}
+
+inline void* allocate(size_t bytes, size_t align) {
+    void* p = nullptr;
+    if (align <= alignof(max_align_t)) p = malloc(bytes ? bytes : 1);
+    else if (posix_memalign(&p, align, bytes ? bytes : 1) != 0) p = nullptr;
+    if (p) allocated(p);
+    return p;
+}
+
+// Starts a measurement: the peak restarts from the bytes live now. @return That baseline.
+inline long long resetPeak() {
+    long long now = live.load(memory_order_relaxed);
+    peak.store(now, memory_order_relaxed);
+    return now;
+}
+}  // namespace heap_stats
+
+void* operator new(size_t n) {
+    if (void* p = heap_stats::allocate(n, 0)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t n) { return operator new(n); }
+void* operator new(size_t n, align_val_t a) {
+    if (void* p = heap_stats::allocate(n, (size_t)a)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t n, align_val_t a) { return operator new(n, a); }
+void* operator new(size_t n, const nothrow_t&) noexcept { return heap_stats::allocate(n, 0); }
+void* operator new[](size_t n, const nothrow_t&) noexcept { return heap_stats::allocate(n, 0); }
+void* operator new(size_t n, align_val_t a, const nothrow_t&) noexcept { return heap_stats::allocate(n, (size_t)a); }
+void* operator new[](size_t n, align_val_t a, const nothrow_t&) noexcept {
+    return heap_stats::allocate(n, (size_t)a);
+}
+void operator delete(void* p) noexcept {
+    heap_stats::released(p);
+    free(p);
+}
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+void operator delete(void* p, align_val_t) noexcept { operator delete(p); }
+void operator delete[](void* p, align_val_t) noexcept { operator delete(p); }
+void operator delete(void* p, size_t, align_val_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t, align_val_t) noexcept { operator delete(p); }
+void operator delete(void* p, const nothrow_t&) noexcept { operator delete(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { operator delete(p); }
+void operator delete(void* p, align_val_t, const nothrow_t&) noexcept { operator delete(p); }
+void operator delete[](void* p, align_val_t, const nothrow_t&) noexcept { operator delete(p); }
+
+// ---- The repository sorts, each isolated in its own namespace ----
+#pragma push_macro("main")
+#undef main
+#define main merge_demo_main
+namespace merge_impl {
+#include "MergeSort.c++"
+}
+#undef main
+#define main natural_merge_demo_main
+namespace natural_merge_impl {
+#include "Natural_Merge_Sort.c++"
+}
+#undef main
+#define main parallel_merge_demo_main
+namespace parallel_merge_impl {
+#include "Parallel_Merge_Sort.c++"
+}
+#undef main
+#define main quick_demo_main
+namespace quick_impl {
+#include "Quick_Sort.c++"
+}
+#undef main
+#define main block_quick_demo_main
+namespace block_quick_impl {
+#include "Block_Quick_Sort.c++"
+}
+#undef main
+#define main parallel_quick_demo_main
+namespace parallel_quick_impl {
+#include "Parallel_Quick_Sort.c++"
+}
+#undef main
+#define main radix_demo_main
+namespace radix_impl {
+#include "Radix_Sort.c++"
+}
+#undef main
+#define main sample_demo_main
+namespace sample_impl {
+#include "Parallel_Sample_Sort.c++"
+}
+#undef main
+#define main generic_demo_main
+namespace generic_impl {
+#include "Generic_Sort.c++"
+}
+#pragma pop_macro("main")
+
+// One CSV / JSON row.
+struct Record {
+    string input, sort;
+    long long n = 0;
+    int reps = 0;
+    double seconds = 0;
+    long long comparisons = -1, moves = -1, instructions = -1, branchMisses = -1;
+    long long peakHeapKB = 0;   // Peak live heap during the run - live heap at its start
+    bool verified = false;
+};
+
+// Element type that counts its copies and moves (for the counting pass).
+struct Counted {
+    int v = 0;
+    static long long moves;
+
+    Counted() = default;
+    Counted(int v) : v(v) {}
+    Counted(const Counted& o) : v(o.v) { moves++; }
+    Counted(Counted&& o) noexcept : v(o.v) { moves++; }
+    Counted& operator=(const Counted& o) {
+        v = o.v;
+        moves++;
+        return *this;
+    }
+    Counted& operator=(Counted&& o) noexcept {
+        v = o.v;
+        moves++;
+        return *this;
+    }
+};
+long long Counted::moves = 0;
+
+class InputGenerator {
+private:
+    mt19937_64 rng;
+
+    /**
+     * Zipf(s = 1) over ranks 1..U (U = min(n, 2^20)), by inverse-CDF lookup.
+     */
+    vector<int> zipf(int n) {
+        int universe = max(1, min(n, 1 << 20));
+        vector<double> cdf(universe);
+        double sum = 0;
+        for (int r = 0; r < universe; r++) cdf[r] = sum += 1.0 / (r + 1);
+        uniform_real_distribution<double> u(0, sum);
+        vector<int> a(n);
+        for (int& x : a) x = lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin();
+        return a;
+    }
+
+    /**
+     * McIlroy's adversary: values are decided lazily while the target sort runs.
+     * Every element starts as "gas" (larger than anything decided); when two gas
+     * elements meet, one is frozen to the next smallest value, preferring the
+     * element most recently compared (the likely pivot). The frozen values form an
+     * input on which the target makes the same, worst-case, comparisons.
+     */
+    vector<int> killer(int n) {
+        const int gas = n;
+        vector<int> val(n, gas), idx(n);
+        iota(idx.begin(), idx.end(), 0);
+        int solid = 0, candidate = 0;
+        auto adversary = [&](int x, int y) {
+            if (val[x] == gas && val[y] == gas) {
+                if (x == candidate) val[x] = solid++;
+                else val[y] = solid++;
+            }
+            if (val[x] == gas) candidate = x;
+            else if (val[y] == gas) candidate = y;
+            return val[x] < val[y];
+        };
+        generic_impl::Solution().quickSort(idx.begin(), idx.end(), adversary);
+        return val;
+    }
+
+public:
+    explicit InputGenerator(uint64_t seed) : rng(seed) {}
+
+    vector<int> make(const string& shape, int n) {
+        if (shape == "zipf") return zipf(n);
+        if (shape == "killer") return killer(n);
+        vector<int> a(n);
+        for (int i = 0; i < n; i++) {
+            a[i] = shape == "random"  ? (int)rng()
+                 : shape == "sorted"  ? i
+                 : shape == "reverse" ? n - i
+                 : shape == "organ"   ? min(i, n - 1 - i)
+                                      : (int)(rng() % 16);   // "few"
+        }
+        return a;
+    }
+};
+
+/**
+ * Hardware counters for the calling thread: instructions and branch misses.
+ */
+class PerfCounters {
+private:
+    int leader = -1, member = -1;
+
+    static int openEvent(uint64_t config, int group) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+    }
+
+public:
+    PerfCounters() {
+        leader = openEvent(PERF_COUNT_HW_INSTRUCTIONS, -1);
+        if (leader >= 0) member = openEvent(PERF_COUNT_HW_BRANCH_MISSES, leader);
+        if (member < 0 && leader >= 0) {
+            close(leader);
+            leader = -1;
+        }
+    }
+    ~PerfCounters() {
+        if (member >= 0) close(member);
+        if (leader >= 0) close(leader);
+    }
+
+    bool available() const { return leader >= 0; }
+
+    void start() {
+        if (!available()) return;
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    /**
+     * @return {instructions, branch misses}, or {-1, -1} without counters.
+     */
+    pair<long long, long long> stop() {
+        if (!available()) return {-1, -1};
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t data[3] = {0, 0, 0};   // {nr, instructions, branch misses}
+        if (read(leader, data, sizeof(data)) != (ssize_t)sizeof(data)) return {-1, -1};
+        return {(long long)data[1], (long long)data[2]};
+    }
+};
+
+// A sort under test: the timed vector<int> entry point and, when its comparisons and
+// moves can be counted, the counting pass ({comparisons, moves}).
+struct SortEntry {
+    string name;
+    function<void(vector<int>&, int, int)> run;
+    function<pair<long long, long long>(const vector<int>&)> count;
+};
+
+class BenchmarkSuite {
+private:
+    static constexpr long long MIN_ELEMENTS_PER_RUN = 1 << 20;   // Repeat small sizes up to this
+
+    vector<Record> records;
+    vector<SortEntry> sorts;
+    long long countLimit;
+    PerfCounters perf;
+
+    // Solver objects (thread pools, scratch buffers), rebuilt before every timed run so
+    // each run starts without scratch left over by another sort or input.
+    struct Solvers {
+        merge_impl::Solution merge;
+        natural_merge_impl::Solution natural;
+        parallel_merge_impl::Solution parallelMerge;
+        quick_impl::Solution quick;
+        block_quick_impl::Solution block;
+        parallel_quick_impl::Solution parallelQuick;
+        radix_impl::Solution radix;
+        sample_impl::Solution sample;
+        generic_impl::Solution generic;
+
+        explicit Solvers(int threads)
+            : parallelMerge(threads), parallelQuick(threads), sample(sample_impl::SampleSortOptions{threads}) {}
+    };
+    int threads;
+    unique_ptr<Solvers> solvers;
+
+    /**
+     * Counting pass for sorts that take (first, last, comp) on any element type.
+     */
+    template <typename Sorter>
+    static pair<long long, long long> countWith(const vector<int>& input, Sorter&& sorter) {
+        vector<Counted> work(input.begin(), input.end());
+        long long comparisons = 0;
+        Counted::moves = 0;
+        sorter(work, [&comparisons](const Counted& a, const Counted& b) {
+            comparisons++;
+            return a.v < b.v;
+        });
+        return {comparisons, Counted::moves};
+    }
+
+    /**
+     * Counting pass for radix_lsd, which compares nothing: each digit pass that
+     * Radix_Sort.c++ does not skip (every key sharing the digit) moves all n keys,
+     * and an odd pass count ends in the buffer, costing one more n for the copy back.
+     * Matches radixSort's defaults; below its insertion cutoff the insertion sort is
+     * counted instead.
+     */
+    static pair<long long, long long> countRadixLsd(const vector<int>& input) {
+        constexpr int BITS = 11, PASSES = (32 + BITS - 1) / BITS, MASK = (1 << BITS) - 1;
+        constexpr int INSERTION_CUTOFF = 64;   // Radix_Sort.c++
+        int n = input.size();
+        if (n < INSERTION_CUTOFF) {
+            return countWith(input, [](auto& v, auto cmp) {   // Radix_Sort.c++ insertionSort
+                for (int i = 1; i < (int)v.size(); i++) {
+                    auto key = v[i];
+                    int j = i - 1;
+                    while (j >= 0 && cmp(key, v[j])) {
+                        v[j + 1] = v[j];
+                        j--;
+                    }
+                    v[j + 1] = key;
+                }
+            });
+        }
+        int executed = 0;
+        for (int p = 0; p < PASSES; p++) {
+            int shift = p * BITS;
+            unsigned first = ((unsigned)input[0] >> shift) & MASK;
+            executed += any_of(input.begin(), input.end(),
+                               [&](int x) { return (((unsigned)x >> shift) & MASK) != first; });
+        }
+        return {0, (long long)n * (executed + executed % 2)};
+    }
+
+    void registerSorts(const set<string>& wanted) {
+        vector<SortEntry> all = {
+            {"std_sort", [](vector<int>& a, int l, int r) { sort(a.begin() + l, a.begin() + r + 1); },
+             [](const vector<int>& in) {
+                 return countWith(in, [](auto& v, auto cmp) { sort(v.begin(), v.end(), cmp); });
+             }},
+            {"std_stable", [](vector<int>& a, int l, int r) { stable_sort(a.begin() + l, a.begin() + r + 1); },
+             [](const vector<int>& in) {
+                 return countWith(in, [](auto& v, auto cmp) { stable_sort(v.begin(), v.end(), cmp); });
+             }},
+            {"merge", [this](vector<int>& a, int l, int r) { solvers->merge.mergeSort(a, l, r); }, nullptr},
+            {"natural_merge", [this](vector<int>& a, int l, int r) { solvers->natural.mergeSort(a, l, r); }, nullptr},
+            {"bottom_up_merge", [this](vector<int>& a, int l, int r) { solvers->natural.bottomUpMergeSort(a, l, r); },
+             nullptr},
+            {"parallel_merge", [this](vector<int>& a, int l, int r) { solvers->parallelMerge.mergeSort(a, l, r); },
+             nullptr},
+            {"quick", [this](vector<int>& a, int l, int r) { solvers->quick.quickSort(a, l, r); }, nullptr},
+            {"block_quick", [this](vector<int>& a, int l, int r) { solvers->block.blockQuickSort(a, l, r); }, nullptr},
+            {"parallel_quick", [this](vector<int>& a, int l, int r) { solvers->parallelQuick.quickSort(a, l, r); },
+             nullptr},
+            {"radix_lsd", [this](vector<int>& a, int l, int r) { solvers->radix.radixSort(a, l, r); }, countRadixLsd},
+            {"american_flag", [this](vector<int>& a, int l, int r) { solvers->radix.americanFlagSort(a, l, r); },
+             nullptr},
+            {"sample", [this](vector<int>& a, int l, int r) { solvers->sample.sampleSort(a, l, r); }, nullptr},
+            {"generic_merge",
+             [this](vector<int>& a, int l, int r) { solvers->generic.mergeSort(a.begin() + l, a.begin() + r + 1); },
+             [this](const vector<int>& in) {
+                 return countWith(in, [this](auto& v, auto cmp) { solvers->generic.mergeSort(v.begin(), v.end(), cmp); });
+             }},
+            {"generic_quick",
+             [this](vector<int>& a, int l, int r) { solvers->generic.quickSort(a.begin() + l, a.begin() + r + 1); },
+             [this](const vector<int>& in) {
+                 return countWith(in, [this](auto& v, auto cmp) { solvers->generic.quickSort(v.begin(), v.end(), cmp); });
+             }},
+        };
+        for (auto& s : all) {
+            if (wanted.count(s.name)) sorts.push_back(move(s));
+        }
+    }
+
+public:
+    BenchmarkSuite(const set<string>& wanted, int threads, long long countLimit)
+        : countLimit(countLimit), threads(threads), solvers(make_unique<Solvers>(threads)) {
+        registerSorts(wanted);
+        if (!perf.available()) cerr << "perf_event_open unavailable: hardware counters reported as -1" << endl;
+    }
+
+    /**
+     * Runs every registered sort on one input.
+     */
+    void run(const string& shape, const vector<int>& input) {
+        int n = input.size();
+        int reps = (int)max(1LL, MIN_ELEMENTS_PER_RUN / max(n, 1));
+        vector<int> expected = input;
+        sort(expected.begin(), expected.end());
+        cerr << "INPUT " << shape << " n=" << n << " (x" << reps << ")" << endl;
+
+        vector<int> work((size_t)n * reps);
+        for (const SortEntry& s : sorts) {
+            for (int r = 0; r < reps; r++) copy(input.begin(), input.end(), work.begin() + (size_t)r * n);
+
+            solvers.reset();
+            solvers = make_unique<Solvers>(threads);
+            long long heapBefore = heap_stats::resetPeak();
+            perf.start();
+            auto t0 = chrono::steady_clock::now();
+            for (int r = 0; r < reps; r++) s.run(work, r * n, r * n + n - 1);
+            auto t1 = chrono::steady_clock::now();
+            pair<long long, long long> hw = perf.stop();
+
+            Record rec;
+            rec.input = shape;
+            rec.sort = s.name;
+            rec.n = n;
+            rec.reps = reps;
+            rec.seconds = chrono::duration<double>(t1 - t0).count();
+            rec.instructions = hw.first;
+            rec.branchMisses = hw.second;
+            rec.peakHeapKB = (heap_stats::peak.load() - heapBefore) / 1024;
+            rec.verified = true;
+            for (int r = 0; r < reps && rec.verified; r++) {
+                rec.verified = equal(expected.begin(), expected.end(), work.begin() + (size_t)r * n);
+            }
+            if (s.count && n <= countLimit) tie(rec.comparisons, rec.moves) = s.count(input);
+            records.push_back(rec);
+
+            cerr << "  " << left << setw(16) << s.name << right << fixed << setprecision(2) << setw(10)
+                 << rec.seconds * 1e9 / ((double)n * reps) << " ns/elem" << (rec.verified ? "" : "  [MISMATCH]")
+                 << endl;
+        }
+    }
+
+    void emit(ostream& out, const string& format) {
+        auto nsPerElement = [](const Record& r) { return r.n ? r.seconds * 1e9 / ((double)r.n * r.reps) : 0.0; };
+        if (format == "json") {
+            out << "[\n";
+            for (size_t i = 0; i < records.size(); i++) {
+                const Record& r = records[i];
+                out << "  {\"input\": \"" << r.input << "\", \"sort\": \"" << r.sort << "\", \"n\": " << r.n
+                    << ", \"reps\": " << r.reps << ", \"seconds\": " << fixed << setprecision(6) << r.seconds
+                    << ", \"ns_per_element\": " << setprecision(3) << nsPerElement(r)
+                    << ", \"comparisons\": " << r.comparisons << ", \"moves\": " << r.moves
+                    << ", \"instructions\": " << r.instructions << ", \"branch_misses\": " << r.branchMisses
+                    << ", \"peak_heap_kb\": " << r.peakHeapKB << ", \"verified\": " << (r.verified ? "true" : "false")
+                    << "}" << (i + 1 == records.size() ? "\n" : ",\n");
+            }
+            out << "]" << endl;
+        } else {
+            out << "input,sort,n,reps,seconds,ns_per_element,comparisons,moves,instructions,branch_misses,"
+                   "peak_heap_kb,verified\n";
+            for (const Record& r : records) {
+                out << r.input << "," << r.sort << "," << r.n << "," << r.reps << "," << fixed << setprecision(6)
+                    << r.seconds << "," << setprecision(3) << nsPerElement(r) << "," << r.comparisons << ","
+                    << r.moves << "," << r.instructions << "," << r.branchMisses << "," << r.peakHeapKB << ","
+                    << (r.verified ? 1 : 0) << "\n";
+            }
+        }
+    }
+};
+
+// ================= MAIN PROTOCOL (Benchmark Driver) =================
+
+struct Options {
+    string sizes = "10,1000,100000,1000000";
+    string inputs = "random,sorted,reverse,organ,few,zipf,killer";
+    string sorts = "std_sort,std_stable,merge,natural_merge,bottom_up_merge,parallel_merge,quick,block_quick,"
+                   "parallel_quick,radix_lsd,american_flag,sample,generic_merge,generic_quick";
+    string format = "csv";
+    int threads = max(1u, thread::hardware_concurrency());
+    long long countLimit = 1 << 22;
+    uint64_t seed = 49;
+};
+
+vector<string> splitList(const string& list) {
+    vector<string> out;
+    stringstream ss(list);
+    for (string item; getline(ss, item, ',');) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        auto value = [&](const string& key) { return arg.substr(key.size()); };
+        if (arg.rfind("--sizes=", 0) == 0) opt.sizes = value("--sizes=");
+        else if (arg.rfind("--inputs=", 0) == 0) opt.inputs = value("--inputs=");
+        else if (arg.rfind("--sorts=", 0) == 0) opt.sorts = value("--sorts=");
+        else if (arg.rfind("--threads=", 0) == 0) opt.threads = stoi(value("--threads="));
+        else if (arg.rfind("--count-limit=", 0) == 0) opt.countLimit = stoll(value("--count-limit="));
+        else if (arg.rfind("--format=", 0) == 0) opt.format = value("--format=");
+        else if (arg.rfind("--seed=", 0) == 0) opt.seed = stoull(value("--seed="));
+        else {
+            cerr << "Unknown option: " << arg << endl;
+            return 1;
+        }
+    }
+
+    vector<string> sortNames = splitList(opt.sorts);
+    BenchmarkSuite suite(set<string>(sortNames.begin(), sortNames.end()), opt.threads, opt.countLimit);
+    InputGenerator gen(opt.seed);
+
+    cerr << "INITIATING SORTING PERFORMANCE AUDIT..." << endl;
+    for (const string& size : splitList(opt.sizes)) {
+        long long n = (long long)stod(size);   // Accepts 1e9
+        if (n < 1 || n > INT_MAX) {
+            cerr << "Size out of range (1 .. 2^31-1): " << size << endl;
+            return 1;
+        }
+        for (const string& shape : splitList(opt.inputs)) suite.run(shape, gen.make(shape, (int)n));
+    }
+    suite.emit(cout, opt.format);
+    cerr << "MISSION COMPLETE." << endl;
+    return 0;
+}
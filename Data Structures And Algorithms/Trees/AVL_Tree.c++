@@ -0,0 +1,318 @@
+/**
+ * @file avl_tree.cpp
+ * @author LuShadowX
+ * @brief Self-balancing Binary Search Tree (AVL) with the same insert / search /
+ * delNode operations as Insert_In_BST, Search_in_BST and Delete_a_node_in_BST.
+ * @difficulty: Medium (Rank B)
+ * @tags: Binary Search Tree, AVL Tree, Self-Balancing, Rotations, Recursion
+ * @logic: The plain BST operations are kept step for step. Every node additionally
+ * stores its height, and on the way back up the recursion each node on the path
+ * is rebalanced:
+ * 1. Recompute height = 1 + max(height(left), height(right)).
+ * 2. Balance factor bf = height(left) - height(right). AVL requires |bf| <= 1.
+ * 3. bf = +2: Left-Left -> rotate right; Left-Right -> rotate the left child left
+ *    first, then rotate right.
+ * 4. bf = -2: the mirror cases (Right-Right, Right-Left).
+ * Because a rotation can change the subtree root, callers must ALWAYS keep the
+ * returned pointer: root = solver.insert(root, key). The plain BST lets callers
+ * ignore it for a non-empty tree.
+ */
+
+/**
+ * ============================================================================
+ * MATHEMATICAL FOUNDATION & FORMULAE
+ * ============================================================================
+ * [Height Bound]
+ * Let N(h) be the fewest nodes in an AVL tree of height h (a "Fibonacci tree"):
+ * N(h) = 1 + N(h-1) + N(h-2), N(1) = 1, N(2) = 2, so N(h) = F(h+2) - 1 >= φ^h / √5.
+ * Hence h < 1.4405 * log2(N + 2) - 0.3277: about 30 levels for 10^6 keys, 43 for 10^9.
+ *
+ * [Why the Plain BST Fails]
+ * Inserting keys in sorted order (as an ID generator does) puts each new key on the
+ * rightmost path: height = N, every operation is O(N), and building the tree costs
+ * O(N^2). The recursive insert also needs N stack frames, so it overflows the
+ * stack at a few hundred thousand keys.
+ *
+ * [Rotations]
+ * rotateRight(y): x = y->left; y->left = x->right; x->right = y. Inorder order is
+ * unchanged (x.left < x < x.right < y < y.right), so the BST invariant holds.
+ * After insertion at most one (single or double) rotation is needed. After deletion
+ * rotations can propagate up to the root, each O(1).
+ *
+ * [Complexity]
+ * insert, search, delNode: O(log N) time. The recursion stack is O(log N).
+ * Space: one extra int (height) per node.
+ * ============================================================================
+ */
+
+/**
+ * MISSION: Balanced Hierarchy Protocol
+ * RANK: B (Self-Balancing Structure)
+ * DEPARTMENT: Hierarchical Data Structures & Dynamic Modifications
+ * CHALLENGE:
+ * Support insert, search and delete on a BST whose height stays O(log N) for ANY
+ * insertion order, including sorted and adversarial sequences.
+ * CONSTRAINTS:
+ * - Time Complexity: O(log N) per operation, worst case.
+ * - Space Complexity: O(N) nodes, O(log N) recursion stack.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Unbalanced baseline, for the benchmark.
+#pragma push_macro("main")
+#undef main
+#define main insert_bst_demo_main
+namespace bst_impl {
+#include "Insert_In_BST.c++"
+}
+#pragma pop_macro("main")
+
+// Binary Tree Node, extended with the AVL height.
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    int height;   // Nodes on the longest downward path: leaf = 1, NULL = 0
+    Node(int val) : data(val), left(nullptr), right(nullptr), height(1) {}
+};
+
+class Solution {
+private:
+    static int height(Node* node) { return node ? node->height : 0; }
+
+    static void updateHeight(Node* node) { node->height = 1 + max(height(node->left), height(node->right)); }
+
+    static int balanceFactor(Node* node) { return height(node->left) - height(node->right); }
+
+    static Node* rotateRight(Node* y) {
+        Node* x = y->left;
+        y->left = x->right;
+        x->right = y;
+        updateHeight(y);
+        updateHeight(x);
+        return x;
+    }
+
+    static Node* rotateLeft(Node* x) {
+        Node* y = x->right;
+        x->right = y->left;
+        y->left = x;
+        updateHeight(x);
+        updateHeight(y);
+        return y;
+    }
+
+    /**
+     * Restores |bf| <= 1 at a node whose subtrees are already AVL trees.
+     * @return The new root of this subtree.
+     */
+    static Node* rebalance(Node* node) {
+        updateHeight(node);
+        int bf = balanceFactor(node);
+        if (bf > 1) {
+            // Left-Right: turn it into Left-Left first.
+            if (balanceFactor(node->left) < 0) node->left = rotateLeft(node->left);
+            return rotateRight(node);
+        }
+        if (bf < -1) {
+            // Right-Left: turn it into Right-Right first.
+            if (balanceFactor(node->right) > 0) node->right = rotateRight(node->right);
+            return rotateLeft(node);
+        }
+        return node;
+    }
+
+public:
+    /**
+     * Inserts a key (duplicates go left, as in Insert_In_BST).
+     * @return The new root of the subtree; always store it.
+     */
+    Node* insert(Node* root, int key) {
+        if (root == NULL) {
+            return new Node(key);
+        }
+        if (root->data < key) {
+            root->right = insert(root->right, key);
+        } else {
+            root->left = insert(root->left, key);
+        }
+        return rebalance(root);
+    }
+
+    /**
+     * @return true if the key is present. The height is O(log N), so a loop replaces
+     * the recursion of Search_in_BST.
+     */
+    bool search(Node* root, int key) {
+        while (root != NULL) {
+            if (root->data == key) return true;
+            root = key < root->data ? root->left : root->right;
+        }
+        return false;
+    }
+
+    /**
+     * Deletes one occurrence of the key (successor strategy, as in Delete_a_node_in_BST).
+     * @return The new root of the subtree; always store it.
+     */
+    Node* delNode(Node* root, int key) {
+        if (root == NULL) {
+            return NULL;
+        }
+        if (root->data < key) {
+            root->right = delNode(root->right, key);
+        } else if (root->data > key) {
+            root->left = delNode(root->left, key);
+        } else {
+            // CASE 1 & 2: zero or one child. The surviving child is already an AVL tree.
+            if (root->left == NULL || root->right == NULL) {
+                Node* temp = root->left ? root->left : root->right;
+                delete root;
+                return temp;
+            }
+            // CASE 3: two children. Copy the in-order successor, then delete it.
+            Node* temp = root->right;
+            while (temp->left != NULL) {
+                temp = temp->left;
+            }
+            root->data = temp->data;
+            root->right = delNode(root->right, root->data);
+        }
+        return rebalance(root);
+    }
+
+    /**
+     * @return Height in nodes (empty tree = 0), O(1).
+     */
+    int treeHeight(Node* root) { return height(root); }
+
+    void destroy(Node* root) {
+        if (root == NULL) return;
+        destroy(root->left);
+        destroy(root->right);
+        delete root;
+    }
+};
+
+// ================= MAIN PROTOCOL (Testing + Benchmark) =================
+
+// Helper function: Inorder Traversal to verify BST property (prints sorted)
+void inorderPrint(Node* root) {
+    if (root == nullptr) return;
+    inorderPrint(root->left);
+    cout << root->data << " ";
+    inorderPrint(root->right);
+}
+
+// Checks order, stored heights and |bf| <= 1 everywhere. Returns the height, or -1.
+int verifyAVL(Node* root, long long low, long long high) {
+    if (root == nullptr) return 0;
+    if (root->data < low || root->data > high) return -1;
+    int l = verifyAVL(root->left, low, root->data);
+    int r = verifyAVL(root->right, root->data, high);
+    if (l < 0 || r < 0 || abs(l - r) > 1 || root->height != 1 + max(l, r)) return -1;
+    return root->height;
+}
+
+// Baseline height and cleanup without recursion: a degenerate tree is N levels deep.
+int baselineHeightAndFree(bst_impl::Node* root) {
+    int best = 0;
+    vector<pair<bst_impl::Node*, int>> stack;
+    if (root) stack.push_back({root, 1});
+    while (!stack.empty()) {
+        auto [node, depth] = stack.back();
+        stack.pop_back();
+        best = max(best, depth);
+        if (node->left) stack.push_back({node->left, depth + 1});
+        if (node->right) stack.push_back({node->right, depth + 1});
+        delete node;
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    Solution solver;
+    Node* root = nullptr;
+
+    cout << "INITIATING BALANCED HIERARCHY PROTOCOL..." << endl;
+    cout << "-----------------------------" << endl;
+
+    // Sorted insertion: a plain BST would become the chain 1 -> 2 -> ... -> 7.
+    cout << "Inserting in sorted order: 1 2 3 4 5 6 7" << endl;
+    for (int key = 1; key <= 7; key++) root = solver.insert(root, key);
+    cout << "Root: " << root->data << ", Height: " << solver.treeHeight(root) << endl;
+    // Expected Output: Root: 4, Height: 3 (perfectly balanced)
+    cout << "Search 5: " << (solver.search(root, 5) ? "FOUND" : "NOT FOUND") << ", Search 9: "
+         << (solver.search(root, 9) ? "FOUND" : "NOT FOUND") << endl;
+    // Expected Output: Search 5: FOUND, Search 9: NOT FOUND
+    root = solver.delNode(root, 4);
+    root = solver.delNode(root, 1);
+    cout << "After deleting 4 and 1 (Inorder): ";
+    inorderPrint(root);
+    cout << "| Height: " << solver.treeHeight(root) << endl;
+    // Expected Output: 2 3 5 6 7 | Height: 3
+    solver.destroy(root);
+    cout << "-----------------------------" << endl;
+
+    // --- Benchmark: AVL vs the plain BST of Insert_In_BST on several insertion orders ---
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    const int BASELINE_DEGENERATE_LIMIT = 20000;   // O(N^2) build and N-deep recursion beyond this
+    mt19937 rng(50);
+    auto ms = [](auto a, auto b) { return chrono::duration<double, milli>(b - a).count(); };
+    double bound = 1.4405 * log2(n + 2.0) - 0.3277;
+    cout << "BENCHMARK (N=" << n << ", ms; AVL height bound " << (int)bound << "):" << endl;
+
+    for (string order : {"sorted", "reversed", "random", "zigzag"}) {
+        // Even keys, so odd probes are guaranteed misses.
+        vector<int> keys(n);
+        for (int i = 0; i < n; i++) {
+            int rank = order == "zigzag" ? (i % 2 ? n - 1 - i / 2 : i / 2) : order == "reversed" ? n - 1 - i : i;
+            keys[i] = 2 * rank;
+        }
+        if (order == "random") shuffle(keys.begin(), keys.end(), rng);
+
+        Node* avl = nullptr;
+        auto t0 = chrono::steady_clock::now();
+        for (int key : keys) avl = solver.insert(avl, key);
+        auto t1 = chrono::steady_clock::now();
+        int hits = 0;
+        for (int key : keys) hits += solver.search(avl, key) + solver.search(avl, key + 1);
+        auto t2 = chrono::steady_clock::now();
+        for (int i = 0; i < n; i += 2) avl = solver.delNode(avl, keys[i]);
+        auto t3 = chrono::steady_clock::now();
+        int verified = n ? verifyAVL(avl, LLONG_MIN, LLONG_MAX) : 0;
+        bool ok = hits == n && verified >= 0 && verified <= bound && !solver.search(avl, keys.empty() ? 0 : keys[0]);
+        int height = solver.treeHeight(avl);
+        solver.destroy(avl);
+
+        cout << "  " << order << ": AVL insert " << ms(t0, t1) << ", search x2N " << ms(t1, t2) << ", delete N/2 "
+             << ms(t2, t3) << ", height " << height;
+        if (order == "random" || n <= BASELINE_DEGENERATE_LIMIT) {
+            bst_impl::Solution plain;
+            bst_impl::Node* bst = nullptr;
+            auto t4 = chrono::steady_clock::now();
+            for (int key : keys) bst = plain.insert(bst, key);
+            auto t5 = chrono::steady_clock::now();
+            cout << " | plain BST insert " << ms(t4, t5) << ", height " << baselineHeightAndFree(bst);
+        } else {
+            cout << " | plain BST skipped (height N, O(N^2) build)";
+        }
+        cout << (ok ? " [verified]" : " [MISMATCH]") << endl;
+    }
+
+    cout << "-----------------------------" << endl;
+    cout << "MISSION COMPLETE." << endl;
+
+    return 0;
+}